@@ -50,25 +50,40 @@ static Eina_Hash *exec = NULL;
 static Eina_Hash *environments = NULL;
 static Eina_Hash *keywords = NULL;
 
-static int
-cache_add(Eet_File *ef, const char *path, const char *file_id, int priority EINA_UNUSED, int *changed)
+/* Upper bound of parser threads used for a rebuild */
+#define CACHE_LOAD_THREADS_MAX 8
+
+typedef struct _Cache_Entry Cache_Entry;
+struct _Cache_Entry
 {
+    char           *path;
+    char           *file_id;
     Efreet_Desktop *desk;
-    char *ext;
+    int             changed;
+};
 
-    INF("FOUND: %s", path);
-    if (file_id) INF(" (id): %s", file_id);
-    ext = strrchr(path, '.');
-    if (!ext || (strcmp(ext, ".desktop") && strcmp(ext, ".directory"))) return 1;
-    desk = efreet_desktop_new(path);
-    if (desk) INF("  OK");
-    else      INF("  FAIL");
-    if (!desk) return 1;
+typedef struct _Cache_Load Cache_Load;
+struct _Cache_Load
+{
+    Eina_Inarray  *entries;
+    Eina_Spinlock  lock;
+    unsigned int   next;
+};
+
+/* Load one desktop entry. Entries that are unchanged come straight from
+ * the old cache, everything else is parsed. This runs on the parser
+ * threads, efreet_desktop serializes access to the shared cache itself. */
+static void
+cache_load(Cache_Entry *ce)
+{
+    Efreet_Desktop *desk;
+
+    desk = efreet_desktop_new(ce->path);
+    if (!desk) return;
     if (!desk->eet)
     {
         /* This file isn't in cache */
-        *changed = 1;
-        INF("  NEW");
+        ce->changed = 1;
     }
     else
     {
@@ -80,14 +95,102 @@ cache_add(Eet_File *ef, const char *path, const char *file_id, int priority EINA
            if (modtime != desk->load_time)
            {
               efreet_desktop_free(desk);
-              *changed = 1;
-              desk = efreet_desktop_uncached_new(path);
-              if (desk) INF("  CHANGED");
-              else      INF("  NO UNCACHED");
+              ce->changed = 1;
+              desk = efreet_desktop_uncached_new(ce->path);
            }
         }
     }
-    if (!desk) return 1;
+    ce->desk = desk;
+}
+
+static void *
+cache_load_thread(void *data, Eina_Thread t EINA_UNUSED)
+{
+    Cache_Load *cl = data;
+    unsigned int i;
+
+    for (;;)
+    {
+        eina_spinlock_take(&cl->lock);
+        i = cl->next++;
+        eina_spinlock_release(&cl->lock);
+        if (i >= eina_inarray_count(cl->entries)) break;
+        cache_load(eina_inarray_nth(cl->entries, i));
+    }
+    return NULL;
+}
+
+static void
+cache_load_all(Eina_Inarray *entries)
+{
+    Eina_Thread threads[CACHE_LOAD_THREADS_MAX];
+    Cache_Load cl;
+    int count, started = 0, i;
+
+    cl.entries = entries;
+    cl.next = 0;
+    count = eina_cpu_count();
+    if (count > CACHE_LOAD_THREADS_MAX) count = CACHE_LOAD_THREADS_MAX;
+    if ((unsigned int)count > eina_inarray_count(entries))
+      count = eina_inarray_count(entries);
+    if ((count > 1) && eina_spinlock_new(&cl.lock))
+    {
+        /* the calling thread is one of the parsers */
+        for (i = 1; i < count; i++)
+        {
+            if (!eina_thread_create(&threads[started], EINA_THREAD_BACKGROUND,
+                                    -1, cache_load_thread, &cl))
+                break;
+            started++;
+        }
+        cache_load_thread(&cl, 0);
+        for (i = 0; i < started; i++)
+            eina_thread_join(threads[i]);
+        eina_spinlock_free(&cl.lock);
+    }
+    else
+    {
+        Cache_Entry *ce;
+
+        EINA_INARRAY_FOREACH(entries, ce)
+            cache_load(ce);
+    }
+}
+
+static void
+cache_entries_flush(Eina_Inarray *entries)
+{
+    Cache_Entry *ce;
+
+    EINA_INARRAY_FOREACH(entries, ce)
+    {
+        free(ce->path);
+        free(ce->file_id);
+        if (ce->desk) efreet_desktop_free(ce->desk);
+    }
+    eina_inarray_flush(entries);
+}
+
+static int
+cache_add(Eet_File *ef, Cache_Entry *ce, int *changed)
+{
+    Efreet_Desktop *desk = ce->desk;
+    const char *file_id = ce->file_id;
+
+    INF("FOUND: %s", ce->path);
+    if (file_id) INF(" (id): %s", file_id);
+    if (!desk)
+    {
+        INF("  FAIL");
+        return 1;
+    }
+    /* the entry now owns nothing, desk is either stored or freed below */
+    ce->desk = NULL;
+    if (ce->changed)
+    {
+        *changed = 1;
+        INF("  CHANGED");
+    }
     if (file_id && old_file_ids && !eina_hash_find(old_file_ids->hash, file_id))
     {
         *changed = 1;
@@ -163,10 +266,12 @@ stat_cmp(const void *a, const void *b)
    return 1;
 }
 
+/* Collect the desktop files below path in search order. Parsing happens
+ * later in cache_load_all(), so that it can be spread over threads. */
 static int
-cache_scan(Eet_File *ef,
+cache_scan(Eina_Inarray *entries,
            Eina_Inarray *stack, const char *path, const char *base_id,
-           int priority, int recurse, int *changed)
+           int recurse)
 {
     char *file_id = NULL;
     char id[PATH_MAX];
@@ -204,14 +309,27 @@ cache_scan(Eet_File *ef,
         {
            if (recurse)
              {
-                ret = cache_scan(ef, stack, info->path, file_id, priority, recurse, changed);
+                ret = cache_scan(entries, stack, info->path, file_id, recurse);
                 if (!ret) break;
              }
         }
         else
         {
-           ret = cache_add(ef, info->path, file_id, priority, changed);
-           if (!ret) break;
+           Cache_Entry ce = { NULL, NULL, NULL, 0 };
+           const char *ext;
+
+           ext = strrchr(fname, '.');
+           if (!ext || (strcmp(ext, ".desktop") && strcmp(ext, ".directory")))
+             continue;
+           ce.path = strdup(info->path);
+           if (file_id) ce.file_id = strdup(file_id);
+           if (eina_inarray_push(entries, &ce) < 0)
+           {
+              free(ce.path);
+              free(ce.file_id);
+              ret = 0;
+              break;
+           }
         }
     }
     eina_iterator_free(it);
@@ -334,9 +452,10 @@ main(int argc, char **argv)
     Eina_List *extra_dirs = NULL;
     Eina_List *l = NULL;
     Eina_Inarray *stack = NULL;
+    Eina_Inarray *entries = NULL;
+    Cache_Entry *ce;
     Eet_File *ef = NULL;
     Eet_File *util_ef = NULL;
-    int priority = 0;
     char *dir = NULL;
     char *path;
     int lockfd = -1;
@@ -450,13 +569,15 @@ main(int argc, char **argv)
 
     stack = eina_inarray_new(sizeof(struct stat), 16);
     if (!stack) goto error;
+    entries = eina_inarray_new(sizeof(Cache_Entry), 64);
+    if (!entries) goto error;
 
     EINA_LIST_FREE(dirs, path)
      {
         char file_id[PATH_MAX] = { '\0' };
 
         eina_inarray_flush(stack);
-        if (!cache_scan(ef, stack, path, file_id, priority++, 1, &changed))
+        if (!cache_scan(entries, stack, path, file_id, 1))
           goto error;
         systemdirs = eina_list_append(systemdirs, path);
      }
@@ -464,8 +585,17 @@ main(int argc, char **argv)
     EINA_LIST_FOREACH(extra_dirs, l, path)
     {
         eina_inarray_flush(stack);
-        if (!cache_scan(ef, stack, path, NULL, priority, 0, &changed)) goto error;
+        if (!cache_scan(entries, stack, path, NULL, 0)) goto error;
+    }
+
+    /* parse in parallel, but merge in search order so that the first
+     * file for a file id still wins */
+    cache_load_all(entries);
+    EINA_INARRAY_FOREACH(entries, ce)
+    {
+        if (!cache_add(ef, ce, &changed)) goto error;
     }
+    cache_entries_flush(entries);
 
     /* store util */
 #define STORE_HASH_ARRAY(_hash) \
@@ -569,6 +699,7 @@ main(int argc, char **argv)
     EINA_LIST_FREE(systemdirs, dir)
       eina_stringshare_del(dir);
     eina_list_free(extra_dirs);
+    eina_inarray_free(entries);
     eina_inarray_free(stack);
     efreet_shutdown();
     ecore_shutdown();
@@ -582,6 +713,11 @@ error:
     eina_tmpstr_del(tmpuc);
     eina_tmpstr_del(tmpc);
 
+    if (entries)
+    {
+        cache_entries_flush(entries);
+        eina_inarray_free(entries);
+    }
     if (stack) eina_inarray_free(stack);
     IF_FREE(dir);
 edd_error:
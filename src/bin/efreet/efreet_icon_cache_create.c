@@ -1041,6 +1041,8 @@ main(int argc, char **argv)
         {
             Eina_Hash *themes;
             Eina_Hash *icons;
+            void *index;
+            int index_size = 0;
 
             themes = eina_hash_string_superfast_new(NULL);
             icons = eina_hash_string_superfast_new(NULL);
@@ -1061,6 +1063,14 @@ main(int argc, char **argv)
                     eet_data_write(icon_ef, icon_edd, tuple->key, tuple->data, EET_COMPRESSION_SUPERFAST);
                 eina_iterator_free(icons_it);
 
+                /* uncompressed, so readers can use it straight from the map */
+                index = efreet_icon_cache_index_build(icons, &index_size);
+                if (index)
+                {
+                    eet_write(icon_ef, EFREET_CACHE_ICON_INDEX, index, index_size, EET_COMPRESSION_NONE);
+                    free(index);
+                }
+
                 INF("theme change: %s %lld", theme->theme.name.internal, theme->check.mtime);
                 eet_data_write(theme_ef, theme_edd, theme->theme.name.internal, theme, EET_COMPRESSION_SUPERFAST);
             }
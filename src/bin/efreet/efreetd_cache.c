@@ -457,8 +457,25 @@ cache_desktop_update(void)
    desktop_cache_timer = ecore_timer_add(0.2, desktop_cache_update_cache_cb, NULL);
 }
 
+/* Only desktop entries end up in the desktop cache, so file events for
+ * anything else (mimeinfo.cache, editor backups, ...) can't change it */
 static Eina_Bool
-_cb_monitor_event(void *data EINA_UNUSED, int type EINA_UNUSED, void *event)
+_desktop_event_relevant(int type, const char *filename)
+{
+   const char *ext;
+
+   if ((type != EIO_MONITOR_FILE_CREATED) &&
+       (type != EIO_MONITOR_FILE_DELETED) &&
+       (type != EIO_MONITOR_FILE_MODIFIED))
+     return EINA_TRUE;
+   if (!filename) return EINA_TRUE;
+   ext = strrchr(ecore_file_file_get(filename), '.');
+   if (!ext) return EINA_FALSE;
+   return (!strcmp(ext, ".desktop")) || (!strcmp(ext, ".directory"));
+}
+
+static Eina_Bool
+_cb_monitor_event(void *data EINA_UNUSED, int type, void *event)
 {
    Eio_Monitor_Event *ev = event;
 
@@ -470,6 +487,8 @@ _cb_monitor_event(void *data EINA_UNUSED, int type EINA_UNUSED, void *event)
    // if it's a desktop
    else if (eina_hash_find(desktop_change_monitors_mon, &(ev->monitor)))
      {
+        if (!_desktop_event_relevant(type, ev->filename))
+          return ECORE_CALLBACK_PASS_ON;
         cache_desktop_update();
      }
    // if it's a mime file
@@ -50,6 +50,7 @@
 #endif
 
 #define MAX_ID 2000000
+#define MAX_SLAVES 32
 #define DAEMON "daemon"
 #define ODATA "odata"
 
@@ -123,6 +124,8 @@ struct _Ethumbd_Request
    int id;
    const char *file, *key;
    const char *thumb, *thumb_key;
+   unsigned int setup_gen; // setup generation of the client when dispatched
+   Eina_List *dups; // identical requests waiting on this one to finish
    Ethumbd_Setup setup;
 };
 
@@ -136,6 +139,7 @@ struct _Ethumbd_Object
    int id_count;
    int max_id;
    int min_id;
+   unsigned int setup_gen;
    Eldbus_Service_Interface *iface;
 };
 
@@ -145,14 +149,17 @@ struct _Ethumbd_Queue
    int max_count;
    int nqueue;
    int last;
-   int current;
    Ethumbd_Object *table;
    int *list;
 };
 
 struct _Ethumbd_Slave
 {
+   Ethumbd *ed;
    Ecore_Exe *exe;
+   Ethumbd_Request *processing; // request being generated, NULL if idle
+   int current; // queue table index of the processing request
+   Ecore_Timer *hang_timer;
    char *bufcmd; // buffer to read commands from slave
    int scmd; // size of command to read
    int pcmd; // position in the command buffer
@@ -162,12 +169,11 @@ struct _Ethumbd
 {
    Eldbus_Connection *conn;
    Ecore_Idle_Enterer *idle_enterer;
-   Ethumbd_Request *processing;
    Ethumbd_Queue queue;
    double timeout;
    Ecore_Timer *timeout_timer;
-   Ecore_Timer *hang_timer;
-   Ethumbd_Slave slave;
+   Ethumbd_Slave *slaves;
+   int nslaves;
 
    Ecore_Event_Handler *data_cb;
    Ecore_Event_Handler *del_cb;
@@ -193,6 +199,8 @@ const Ecore_Getopt optdesc = {
   {
     ECORE_GETOPT_STORE_DOUBLE
     ('t', "timeout", "finish ethumbd after <timeout> seconds of no activity."),
+    ECORE_GETOPT_STORE_INT
+    ('s', "slaves", "number of slave processes generating thumbnails in parallel, defaults to the number of CPUs."),
     ECORE_GETOPT_LICENSE('L', "license"),
     ECORE_GETOPT_COPYRIGHT('C', "copyright"),
     ECORE_GETOPT_VERSION('V', "version"),
@@ -242,8 +250,9 @@ static const Eldbus_Signal _ethumb_dbus_objects_signals[] = {
   { }
 };
 
-static void _ethumb_dbus_generated_signal(Ethumbd *ed, int *id, const char *thumb_path, const char *thumb_key, Eina_Bool success);
+static void _ethumb_dbus_generated_signal(Ethumbd *ed, int idx, int *id, const char *thumb_path, const char *thumb_key, Eina_Bool success);
 static Eina_Bool _ethumbd_slave_spawn(Ethumbd_Slave *slave, Ethumbd *ed);
+static void _process_queue_start(Ethumbd *ed);
 
 static Eina_Bool
 _ethumbd_timeout_cb(void *data)
@@ -281,21 +290,21 @@ _ethumbd_timeout_redo(Ethumbd *ed)
 static Eina_Bool
 _ethumbd_hang_cb(void *data)
 {
-   Ethumbd *ed = data;
+   Ethumbd_Slave *slave = data;
 
-   ed->hang_timer = NULL;
-   if (ed->processing)
+   slave->hang_timer = NULL;
+   if (slave->processing)
      {
         ERR("timeout while processing thumb");
-        if (ed->slave.exe) ecore_exe_kill(ed->slave.exe);
+        if (slave->exe) ecore_exe_kill(slave->exe);
      }
    return EINA_FALSE;
 }
 
 static void
-_ethumbd_hang_start(Ethumbd *ed)
+_ethumbd_hang_start(Ethumbd_Slave *slave)
 {
-   double tim = ed->timeout;
+   double tim = slave->ed->timeout;
 
    if (tim < 0) tim = 10.0;
    else
@@ -303,23 +312,69 @@ _ethumbd_hang_start(Ethumbd *ed)
         tim = tim / 3.0;
         if (tim > 10.0) tim = 10.0;
      }
-   if (!ed->hang_timer)
-     ed->hang_timer = ecore_timer_add(tim, _ethumbd_hang_cb, ed);
+   if (!slave->hang_timer)
+     slave->hang_timer = ecore_timer_add(tim, _ethumbd_hang_cb, slave);
 }
 
 static void
-_ethumbd_hang_stop(Ethumbd *ed)
+_ethumbd_hang_stop(Ethumbd_Slave *slave)
+{
+   if (!slave->hang_timer) return;
+   ecore_timer_del(slave->hang_timer);
+   slave->hang_timer = NULL;
+}
+
+static void
+_ethumbd_hang_redo(Ethumbd_Slave *slave)
+{
+   _ethumbd_hang_stop(slave);
+   _ethumbd_hang_start(slave);
+}
+
+static Ethumbd_Slave *
+_ethumbd_slave_find(Ethumbd *ed, const Ecore_Exe *exe)
+{
+   int i;
+
+   for (i = 0; i < ed->nslaves; i++)
+     if (ed->slaves[i].exe == exe)
+       return &ed->slaves[i];
+
+   return NULL;
+}
+
+static Ethumbd_Slave *
+_ethumbd_slave_idle_get(Ethumbd *ed)
 {
-   if (!ed->hang_timer) return;
-   ecore_timer_del(ed->hang_timer);
-   ed->hang_timer = NULL;
+   int i;
+
+   for (i = 0; i < ed->nslaves; i++)
+     if ((ed->slaves[i].exe) && (!ed->slaves[i].processing))
+       return &ed->slaves[i];
+
+   return NULL;
+}
+
+static Eina_Bool
+_ethumbd_slaves_busy(Ethumbd *ed)
+{
+   int i;
+
+   for (i = 0; i < ed->nslaves; i++)
+     if (ed->slaves[i].processing)
+       return EINA_TRUE;
+
+   return EINA_FALSE;
 }
 
 static void
-_ethumbd_hang_redo(Ethumbd *ed)
+_ethumbd_request_free(Ethumbd_Request *request)
 {
-   _ethumbd_hang_stop(ed);
-   _ethumbd_hang_start(ed);
+   eina_stringshare_del(request->file);
+   eina_stringshare_del(request->key);
+   eina_stringshare_del(request->thumb);
+   eina_stringshare_del(request->thumb_key);
+   free(request);
 }
 
 static int
@@ -400,6 +455,24 @@ _ethumbd_child_write_op_del(Ethumbd_Slave *slave, int idx)
    _ethumbd_write_safe(slave, &idx, sizeof(idx));
 }
 
+static void
+_ethumbd_slaves_write_op_new(Ethumbd *ed, int idx)
+{
+   int i;
+
+   for (i = 0; i < ed->nslaves; i++)
+     _ethumbd_child_write_op_new(&ed->slaves[i], idx);
+}
+
+static void
+_ethumbd_slaves_write_op_del(Ethumbd *ed, int idx)
+{
+   int i;
+
+   for (i = 0; i < ed->nslaves; i++)
+     _ethumbd_child_write_op_del(&ed->slaves[i], idx);
+}
+
 static void
 _ethumbd_pipe_str_write(Ethumbd_Slave *slave, const char *str)
 {
@@ -431,29 +504,38 @@ _ethumbd_child_write_op_generate(Ethumbd_Slave *slave,
 }
 
 static void
-_generated_cb(Ethumbd *ed, Eina_Bool success, const char *thumb_path, const char *thumb_key)
+_generated_cb(Ethumbd_Slave *slave, Eina_Bool success, const char *thumb_path, const char *thumb_key)
 {
-   int i = ed->queue.current;
+   Ethumbd *ed = slave->ed;
+   Ethumbd_Request *request = slave->processing, *dup;
+   Eina_List *l;
+   int i = slave->current;
 
    DBG("thumbnail ready at: \"%s:%s\"", thumb_path, thumb_key);
 
+   slave->processing = NULL;
    if (ed->queue.table[i].used)
-     _ethumb_dbus_generated_signal
-       (ed, &ed->processing->id, thumb_path, thumb_key, success);
-   eina_stringshare_del(ed->processing->file);
-   eina_stringshare_del(ed->processing->key);
-   eina_stringshare_del(ed->processing->thumb);
-   eina_stringshare_del(ed->processing->thumb_key);
-   free(ed->processing);
-   ed->processing = NULL;
+     {
+        _ethumb_dbus_generated_signal
+          (ed, i, &request->id, thumb_path, thumb_key, success);
+        EINA_LIST_FOREACH(request->dups, l, dup)
+          _ethumb_dbus_generated_signal
+            (ed, i, &dup->id, thumb_path, thumb_key, success);
+     }
+   EINA_LIST_FREE(request->dups, dup)
+     _ethumbd_request_free(dup);
+   _ethumbd_request_free(request);
    _ethumbd_timeout_redo(ed);
-   _ethumbd_hang_stop(ed);
+   _ethumbd_hang_stop(slave);
+
+   if (ed->queue.nqueue)
+     _process_queue_start(ed);
 }
 
 static void
-_ethumbd_slave_cmd_ready(Ethumbd *ed)
+_ethumbd_slave_cmd_ready(Ethumbd_Slave *slave)
 {
-   const char *bufcmd = ed->slave.bufcmd;
+   const char *bufcmd = slave->bufcmd;
    Eina_Bool success;
    const char *thumb_path = NULL;
    const char *thumb_key = NULL;
@@ -482,19 +564,19 @@ _ethumbd_slave_cmd_ready(Ethumbd *ed)
 
 #undef READVAL
 
-   _generated_cb(ed, success, thumb_path, thumb_key);
+   _generated_cb(slave, success, thumb_path, thumb_key);
 
-   free(ed->slave.bufcmd);
-   ed->slave.bufcmd = NULL;
-   ed->slave.scmd = 0;
+   free(slave->bufcmd);
+   slave->bufcmd = NULL;
+   slave->scmd = 0;
 }
 
 static int
-_ethumbd_slave_alloc_cmd(Ethumbd *ed, int ssize, char *sdata)
+_ethumbd_slave_alloc_cmd(Ethumbd_Slave *slave, int ssize, char *sdata)
 {
    int *scmd;
 
-   if (ed->slave.bufcmd)
+   if (slave->bufcmd)
      return 0;
 
    scmd = (int *)sdata;
@@ -502,9 +584,9 @@ _ethumbd_slave_alloc_cmd(Ethumbd *ed, int ssize, char *sdata)
 	ERR("could not read size of command.");
 	return 0;
    }
-   ed->slave.bufcmd = malloc(*scmd);
-   ed->slave.scmd = *scmd;
-   ed->slave.pcmd = 0;
+   slave->bufcmd = malloc(*scmd);
+   slave->scmd = *scmd;
+   slave->pcmd = 0;
 
    return sizeof(*scmd);
 }
@@ -514,10 +596,12 @@ _ethumbd_slave_data_read_cb(void *data, int type EINA_UNUSED, void *event)
 {
    Ethumbd *ed = data;
    Ecore_Exe_Event_Data *ev = event;
+   Ethumbd_Slave *slave;
    int ssize;
    char *sdata;
 
-   if (ev->exe != ed->slave.exe)
+   slave = _ethumbd_slave_find(ed, ev->exe);
+   if (!slave)
      {
 	ERR("PARENT ERROR: slave != ev->exe");
 	return 0;
@@ -528,10 +612,10 @@ _ethumbd_slave_data_read_cb(void *data, int type EINA_UNUSED, void *event)
 
    while (ssize > 0)
      {
-	if (!ed->slave.bufcmd)
+	if (!slave->bufcmd)
 	  {
 	     int n;
-	     n = _ethumbd_slave_alloc_cmd(ed, ssize, sdata);
+	     n = _ethumbd_slave_alloc_cmd(slave, ssize, sdata);
 	     ssize -= n;
 	     sdata += n;
 	  }
@@ -539,16 +623,16 @@ _ethumbd_slave_data_read_cb(void *data, int type EINA_UNUSED, void *event)
 	  {
 	     char *bdata;
 	     int nbytes;
-	     bdata = ed->slave.bufcmd + ed->slave.pcmd;
-	     nbytes = ed->slave.scmd - ed->slave.pcmd;
+	     bdata = slave->bufcmd + slave->pcmd;
+	     nbytes = slave->scmd - slave->pcmd;
 	     nbytes = ssize < nbytes ? ssize : nbytes;
 	     memcpy(bdata, sdata, nbytes);
 	     sdata += nbytes;
 	     ssize -= nbytes;
-	     ed->slave.pcmd += nbytes;
+	     slave->pcmd += nbytes;
 
-	     if (ed->slave.pcmd == ed->slave.scmd)
-	       _ethumbd_slave_cmd_ready(ed);
+	     if (slave->pcmd == slave->scmd)
+	       _ethumbd_slave_cmd_ready(slave);
 	  }
      }
    _ethumbd_timeout_redo(ed);
@@ -560,46 +644,56 @@ _ethumbd_slave_del_cb(void *data, int type EINA_UNUSED, void *event)
 {
    Ethumbd *ed = data;
    Ecore_Exe_Event_Del *ev = event;
+   Ethumbd_Slave *slave;
+   Ethumbd_Request *dup;
+   Eina_List *l;
    int i;
 
-   if (ev->exe != ed->slave.exe)
+   slave = _ethumbd_slave_find(ed, ev->exe);
+   if (!slave)
      return 1;
 
-   _ethumbd_hang_stop(ed);
+   _ethumbd_hang_stop(slave);
 
    if (ev->exited)
      ERR("slave exited with code: %d", ev->exit_code);
    else if (ev->signalled)
      ERR("slave exited by signal: %d", ev->exit_signal);
 
-   if (!ed->processing)
+   if (!slave->processing)
      goto end;
 
-   i = ed->queue.current;
+   i = slave->current;
    ERR("failed to generate thumbnail for: \"%s:%s\"",
-       ed->processing->file, ed->processing->key);
+       slave->processing->file, slave->processing->key);
 
    if (ed->queue.table[i].used)
-     _ethumb_dbus_generated_signal
-       (ed, &ed->processing->id, NULL, NULL, EINA_FALSE);
-   eina_stringshare_del(ed->processing->file);
-   eina_stringshare_del(ed->processing->key);
-   eina_stringshare_del(ed->processing->thumb);
-   eina_stringshare_del(ed->processing->thumb_key);
-   free(ed->processing);
-   ed->processing = NULL;
+     {
+        _ethumb_dbus_generated_signal
+          (ed, i, &slave->processing->id, NULL, NULL, EINA_FALSE);
+        EINA_LIST_FOREACH(slave->processing->dups, l, dup)
+          _ethumb_dbus_generated_signal
+            (ed, i, &dup->id, NULL, NULL, EINA_FALSE);
+     }
+   EINA_LIST_FREE(slave->processing->dups, dup)
+     _ethumbd_request_free(dup);
+   _ethumbd_request_free(slave->processing);
+   slave->processing = NULL;
 
 end:
-   ed->slave.exe = NULL;
-   if (ed->slave.bufcmd)
-     free(ed->slave.bufcmd);
+   slave->exe = NULL;
+   if (slave->bufcmd)
+     free(slave->bufcmd);
 
-   if (!_ethumbd_slave_spawn(&ed->slave, ed))
+   if (!_ethumbd_slave_spawn(slave, ed))
      return EINA_FALSE;
 
    /* restart all queue */
    for (i = 0; i < ed->queue.count; ++i)
-     _ethumbd_child_write_op_new(&ed->slave, ed->queue.list[i]);
+     _ethumbd_child_write_op_new(slave, ed->queue.list[i]);
+
+   if (ed->queue.nqueue)
+     _process_queue_start(ed);
 
    return EINA_TRUE;
 }
@@ -651,13 +745,9 @@ _ethumbd_pipe_write_setup(Ethumbd_Slave *slave, int type, const void *data)
 }
 
 static void
-_process_setup(Ethumbd *ed)
+_process_setup_write(Ethumbd_Slave *slave, int idx, const Ethumbd_Setup *setup)
 {
    int op_id = ETHUMBD_OP_SETUP;
-   int idx = ed->queue.current;
-
-   Ethumbd_Setup *setup = &ed->processing->setup;
-   Ethumbd_Slave *slave = &ed->slave;
 
    _ethumbd_write_safe(slave, &op_id, sizeof(op_id));
    _ethumbd_write_safe(slave, &idx, sizeof(idx));
@@ -709,7 +799,21 @@ _process_setup(Ethumbd *ed)
      _ethumbd_pipe_write_setup(slave, ETHUMBD_DOCUMENT_PAGE,
 			       &setup->document_page);
    _ethumbd_pipe_write_setup(slave, ETHUMBD_SETUP_FINISHED, NULL);
+}
 
+/* Every slave keeps its own Ethumb object per client, so setups go to all
+ * of them. Pipes are ordered, so a slave still generating a thumbnail for
+ * this client only applies the new setup once it is done with it.
+ */
+static void
+_process_setup(Ethumbd *ed, int idx, Ethumbd_Request *request)
+{
+   Ethumbd_Setup *setup = &request->setup;
+   int i;
+
+   for (i = 0; i < ed->nslaves; i++)
+     _process_setup_write(&ed->slaves[i], idx, setup);
+   ed->queue.table[idx].setup_gen++;
 
    if (setup->directory) eina_stringshare_del(setup->directory);
    if (setup->category) eina_stringshare_del(setup->category);
@@ -717,17 +821,39 @@ _process_setup(Ethumbd *ed)
    if (setup->group) eina_stringshare_del(setup->group);
    if (setup->swallow) eina_stringshare_del(setup->swallow);
 
-   free(ed->processing);
-   ed->processing = NULL;
+   free(request);
+}
+
+static Ethumbd_Request *
+_process_file_dup_find(Ethumbd *ed, int idx, const Ethumbd_Request *request)
+{
+   int i;
+
+   /* strings are stringshared, so comparing pointers is enough */
+   for (i = 0; i < ed->nslaves; i++)
+     {
+        Ethumbd_Request *r = ed->slaves[i].processing;
+
+        if ((!r) || (ed->slaves[i].current != idx)) continue;
+        if ((r->setup_gen == request->setup_gen) &&
+            (r->file == request->file) && (r->key == request->key) &&
+            (r->thumb == request->thumb) &&
+            (r->thumb_key == request->thumb_key))
+          return r;
+     }
+
+   return NULL;
 }
 
 static void
-_process_file(Ethumbd *ed)
+_process_file(Ethumbd_Slave *slave, int idx, Ethumbd_Request *request)
 {
-   _ethumbd_hang_redo(ed);
+   slave->processing = request;
+   slave->current = idx;
+   _ethumbd_hang_redo(slave);
    _ethumbd_child_write_op_generate
-     (&ed->slave, ed->queue.current, ed->processing->file,
-      ed->processing->key, ed->processing->thumb, ed->processing->thumb_key);
+     (slave, idx, request->file, request->key,
+      request->thumb, request->thumb_key);
 }
 
 static int
@@ -761,42 +887,55 @@ _process_queue_cb(void *data)
    int i;
    Ethumbd *ed = data;
    Ethumbd_Queue *queue = &ed->queue;
-   Ethumbd_Request *request;
+   Ethumbd_Request *request, *r;
+   Ethumbd_Slave *slave;
 
-   if (ed->processing)
-     return 1;
-
-   if (!queue->nqueue)
-     {
-	ed->idle_enterer = NULL;
-        _ethumbd_timeout_redo(ed);
-	ed->idle_enterer = NULL;
-	return 0;
-     }
-
-   i = _get_next_on_queue(queue);
-   eobject = &(queue->table[i]);
-
-   request = eina_list_data_get(eobject->queue);
-   eobject->queue = eina_list_remove_list(eobject->queue, eobject->queue);
-   ed->queue.current = i;
-   DBG("processing file: \"%s:%s\"...", request->file,
-       request->key);
-   ed->processing = request;
-
-   if (request->id < 0)
-     _process_setup(ed);
-   else
-     {
-	_process_file(ed);
-	_ethumb_dbus_inc_min_id(eobject);
-     }
-   eobject->nqueue--;
-   queue->nqueue--;
-
-   queue->last = i;
-
-   return 1;
+   /* hand out one request per client in turn until every slave is busy;
+    * finished slaves restart us to pick up the rest.
+    */
+   while (queue->nqueue)
+     {
+        slave = _ethumbd_slave_idle_get(ed);
+        if (!slave)
+          {
+             ed->idle_enterer = NULL;
+             return 0;
+          }
+
+        i = _get_next_on_queue(queue);
+        eobject = &(queue->table[i]);
+
+        request = eina_list_data_get(eobject->queue);
+        eobject->queue = eina_list_remove_list(eobject->queue, eobject->queue);
+        eobject->nqueue--;
+        queue->nqueue--;
+        queue->last = i;
+
+        if (request->id < 0)
+          {
+             _process_setup(ed, i, request);
+             continue;
+          }
+
+        _ethumb_dbus_inc_min_id(eobject);
+        request->setup_gen = eobject->setup_gen;
+        r = _process_file_dup_find(ed, i, request);
+        if (r)
+          {
+             DBG("file: \"%s:%s\" already being processed", request->file,
+                 request->key);
+             r->dups = eina_list_append(r->dups, request);
+             continue;
+          }
+
+        DBG("processing file: \"%s:%s\"...", request->file,
+            request->key);
+        _process_file(slave, i, request);
+     }
+
+   ed->idle_enterer = NULL;
+   _ethumbd_timeout_redo(ed);
+   return 0;
 }
 
 static void
@@ -919,8 +1058,8 @@ _ethumb_table_del(Ethumbd *ed, int i)
      }
 
    q->count--;
-   _ethumbd_child_write_op_del(&ed->slave, i);
-   if (!q->count && !ed->processing)
+   _ethumbd_slaves_write_op_del(ed, i);
+   if (!q->count && !_ethumbd_slaves_busy(ed))
      _ethumbd_timeout_redo(ed);
 }
 
@@ -992,9 +1131,8 @@ _ethumb_dbus_ethumb_new_cb(const Eldbus_Service_Interface *interface, const Eldb
    eldbus_name_owner_changed_callback_add(ed->conn, client,
                                          _name_owner_changed_cb, odata,
                                          EINA_TRUE);
-   _ethumbd_child_write_op_new(&ed->slave, i);
+   _ethumbd_slaves_write_op_new(ed, i);
    _ethumbd_timeout_redo(ed);
-   _ethumbd_hang_redo(ed);
 
  end_new:
    reply = eldbus_message_method_return_new(msg);
@@ -1647,7 +1785,7 @@ end:
 }
 
 static void
-_ethumb_dbus_generated_signal(Ethumbd *ed, int *id, const char *thumb_path, const char *thumb_key, Eina_Bool success)
+_ethumb_dbus_generated_signal(Ethumbd *ed, int idx, int *id, const char *thumb_path, const char *thumb_key, Eina_Bool success)
 {
    Eldbus_Message *sig;
    Eldbus_Service_Interface *iface;
@@ -1656,7 +1794,7 @@ _ethumb_dbus_generated_signal(Ethumbd *ed, int *id, const char *thumb_path, cons
 
    id32 = *id;
 
-   iface = ed->queue.table[ed->queue.current].iface;
+   iface = ed->queue.table[idx].iface;
    sig = eldbus_service_signal_new(iface, ETHUMB_DBUS_OBJECTS_SIGNAL_GENERATED);
 
    iter = eldbus_message_iter_get(sig);
@@ -1719,6 +1857,8 @@ _ethumbd_slave_spawn(Ethumbd_Slave *slave, Ethumbd *ed)
 {
    char buf[PATH_MAX];
 
+   slave->ed = ed;
+   slave->processing = NULL;
    slave->bufcmd = NULL;
    slave->scmd = 0;
 
@@ -1744,7 +1884,8 @@ main(int argc, char *argv[])
    int exit_value = 0;
    int arg_idx;
    Ethumbd ed;
-   int child;
+   int i;
+   int nslaves = 0;
    double timeout = 30.0;
 
 #ifdef HAVE_SYS_RESOURCE_H
@@ -1779,33 +1920,9 @@ main(int argc, char *argv[])
         goto finish;
      }
 
-   ed.data_cb = ecore_event_handler_add(ECORE_EXE_EVENT_DATA,
-					_ethumbd_slave_data_read_cb, &ed);
-   ed.del_cb = ecore_event_handler_add(ECORE_EXE_EVENT_DEL,
-				       _ethumbd_slave_del_cb, &ed);
-
-   child = _ethumbd_slave_spawn(&ed.slave, &ed);
-   if (!child)
-     {
-	exit_value = -6;
-	goto finish;
-     }
-
-   if (child == 2)
-     {
-	exit_value = 0;
-	goto finish;
-     }
-
-   if (!eldbus_init())
-     {
-	ERR("could not init eldbus.");
-	exit_value = -1;
-	goto finish;
-     }
-
    Ecore_Getopt_Value values[] = {
      ECORE_GETOPT_VALUE_DOUBLE(timeout),
+     ECORE_GETOPT_VALUE_INT(nslaves),
      ECORE_GETOPT_VALUE_BOOL(quit_option),
      ECORE_GETOPT_VALUE_BOOL(quit_option),
      ECORE_GETOPT_VALUE_BOOL(quit_option),
@@ -1824,6 +1941,42 @@ main(int argc, char *argv[])
    if (quit_option)
      goto finish;
 
+   if (nslaves <= 0) nslaves = eina_cpu_count();
+   if (nslaves <= 0) nslaves = 1;
+   else if (nslaves > MAX_SLAVES) nslaves = MAX_SLAVES;
+
+   ed.slaves = calloc(nslaves, sizeof(Ethumbd_Slave));
+   if (!ed.slaves)
+     {
+	ERR("could not allocate %d slaves.", nslaves);
+	exit_value = -6;
+	goto finish;
+     }
+
+   ed.data_cb = ecore_event_handler_add(ECORE_EXE_EVENT_DATA,
+					_ethumbd_slave_data_read_cb, &ed);
+   ed.del_cb = ecore_event_handler_add(ECORE_EXE_EVENT_DEL,
+				       _ethumbd_slave_del_cb, &ed);
+
+   for (ed.nslaves = 0; ed.nslaves < nslaves; ed.nslaves++)
+     {
+        if (!_ethumbd_slave_spawn(&ed.slaves[ed.nslaves], &ed))
+          break;
+     }
+   if (!ed.nslaves)
+     {
+	exit_value = -6;
+	goto finish;
+     }
+   DBG("running %d slaves", ed.nslaves);
+
+   if (!eldbus_init())
+     {
+	ERR("could not init eldbus.");
+	exit_value = -1;
+	goto finish;
+     }
+
    ed.conn = eldbus_connection_get(ELDBUS_CONNECTION_TYPE_SESSION);
    if (!ed.conn)
      {
@@ -1854,8 +2007,13 @@ main(int argc, char *argv[])
 
    eldbus_shutdown();
  finish:
-   if (ed.slave.exe)
-     ecore_exe_quit(ed.slave.exe);
+   for (i = 0; i < ed.nslaves; i++)
+     {
+        _ethumbd_hang_stop(&ed.slaves[i]);
+        if (ed.slaves[i].exe)
+          ecore_exe_quit(ed.slaves[i].exe);
+     }
+   free(ed.slaves);
 
    if (_pfx) eina_prefix_free(_pfx);
    ethumb_shutdown();
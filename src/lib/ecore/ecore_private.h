@@ -149,6 +149,7 @@ struct _Efl_Loop_Data
    Eina_Inlist         *suspended;
    Efl_Loop_Timer_Data *timer_current;
    int                  timers_added;
+   unsigned int         timers_generation;
 
    Eina_Value           exit_code;
 
@@ -50,8 +50,11 @@ struct _Efl_Loop_Timer_Data
    double     pending;
 
    int        listening;
+   unsigned int added_generation;
 
    Eina_Bool  just_added  : 1;
+   Eina_Bool  queued      : 1; // in loop_data->timers
+   Eina_Bool  suspended   : 1; // in loop_data->suspended
    Eina_Bool  frozen      : 1;
    Eina_Bool  initialized : 1;
    Eina_Bool  noparent    : 1;
@@ -65,6 +68,34 @@ static void _efl_loop_timer_set(Efl_Loop_Timer_Data *timer, double at, double in
 
 static double precision = 10.0 / 1000000.0;
 
+/* Timers set since the last _efl_loop_timer_enable_new() are skipped until
+ * the next loop iteration. Bumping the loop's generation ends that for all
+ * of them at once, instead of walking every pending timer.
+ */
+static inline Eina_Bool
+_efl_loop_timer_just_added(Efl_Loop_Timer_Data *timer)
+{
+   if (!timer->just_added) return EINA_FALSE;
+   if ((timer->loop_data) &&
+       (timer->added_generation == timer->loop_data->timers_generation))
+     return EINA_TRUE;
+   timer->just_added = 0;
+   return EINA_FALSE;
+}
+
+static inline void
+_efl_loop_timer_unqueue(Efl_Loop_Timer_Data *timer)
+{
+   if (timer->queued)
+     timer->loop_data->timers = eina_inlist_remove
+       (timer->loop_data->timers, EINA_INLIST_GET(timer));
+   else if (timer->suspended)
+     timer->loop_data->suspended = eina_inlist_remove
+       (timer->loop_data->suspended, EINA_INLIST_GET(timer));
+   timer->queued = 0;
+   timer->suspended = 0;
+}
+
 EAPI double
 ecore_timer_precision_get(void)
 {
@@ -390,11 +421,7 @@ _efl_loop_timer_efl_object_event_thaw(Eo *obj, Efl_Loop_Timer_Data *timer)
    if (!timer->frozen) return; // Timer not frozen
    timer->frozen = 0;
 
-   if (timer->loop_data)
-     {
-        timer->loop_data->suspended = eina_inlist_remove
-          (timer->loop_data->suspended, EINA_INLIST_GET(timer));
-     }
+   if (timer->loop_data) _efl_loop_timer_unqueue(timer);
    now = ecore_time_get();
    _efl_loop_timer_set(timer, timer->pending + now, timer->in);
 }
@@ -408,8 +435,6 @@ ecore_timer_dump(void)
 static void
 _efl_loop_timer_util_loop_clear(Efl_Loop_Timer_Data *pd)
 {
-   Eina_Inlist *first;
-
    if (!pd->loop_data) return;
    // Check if we are the current timer, if so move along
    if (pd->loop_data->timer_current == pd)
@@ -417,19 +442,13 @@ _efl_loop_timer_util_loop_clear(Efl_Loop_Timer_Data *pd)
        EINA_INLIST_GET(pd)->next;
 
    // Remove the timer from all possible pending list
-   first = eina_inlist_first(EINA_INLIST_GET(pd));
-   if (first == pd->loop_data->timers)
-     pd->loop_data->timers = eina_inlist_remove
-       (pd->loop_data->timers, EINA_INLIST_GET(pd));
-   else if (first == pd->loop_data->suspended)
-     pd->loop_data->suspended = eina_inlist_remove
-       (pd->loop_data->suspended, EINA_INLIST_GET(pd));
+   _efl_loop_timer_unqueue(pd);
 }
 
 static void
 _efl_loop_timer_util_instanciate(Efl_Loop_Data *loop, Efl_Loop_Timer_Data *timer)
 {
-   Efl_Loop_Timer_Data *t2;
+   Efl_Loop_Timer_Data *first, *t2;
 
    if (!loop) return;
    _efl_loop_timer_util_loop_clear(timer);
@@ -440,6 +459,7 @@ _efl_loop_timer_util_instanciate(Efl_Loop_Data *loop, Efl_Loop_Timer_Data *timer
      {
         loop->suspended = eina_inlist_prepend(loop->suspended,
                                               EINA_INLIST_GET(timer));
+        timer->suspended = 1;
         return;
      }
 
@@ -449,6 +469,28 @@ _efl_loop_timer_util_instanciate(Efl_Loop_Data *loop, Efl_Loop_Timer_Data *timer
         return;
      }
 
+   timer->queued = 1;
+   // Look for the spot from whichever end of the list is closer in time,
+   // soon to expire timeouts and far away ones both only walk a few timers
+   first = (Efl_Loop_Timer_Data *)loop->timers;
+   if ((first) &&
+       ((timer->at - first->at) <
+        (((Efl_Loop_Timer_Data *)loop->timers->last)->at - timer->at)))
+     {
+        EINA_INLIST_FOREACH(loop->timers, t2)
+          {
+             if (t2->at > timer->at)
+               {
+                  loop->timers = eina_inlist_prepend_relative(loop->timers,
+                                                              EINA_INLIST_GET(timer),
+                                                              EINA_INLIST_GET(t2));
+                  return;
+               }
+          }
+        loop->timers = eina_inlist_append(loop->timers, EINA_INLIST_GET(timer));
+        return;
+     }
+
    EINA_INLIST_REVERSE_FOREACH(loop->timers, t2)
      {
         if (timer->at > t2->at)
@@ -481,24 +523,18 @@ _efl_loop_timer_util_delay(Efl_Loop_Timer_Data *timer, double add)
 EOLIAN static void
 _efl_loop_timer_efl_object_parent_set(Eo *obj, Efl_Loop_Timer_Data *pd, Efl_Object *parent)
 {
-   Eina_Inlist *first;
-
    efl_parent_set(efl_super(obj, EFL_LOOP_TIMER_CLASS), parent);
 
    if ((!pd->constructed) || (!pd->finalized)) return;
 
    // Remove the timer from all possible pending list
-   first = eina_inlist_first(EINA_INLIST_GET(pd));
-   if (first == pd->loop_data->timers)
+   if (pd->loop_data)
      {
         /* if this timer is currently being processed, update the pointer here so it is not lost */
-        if (pd == pd->loop_data->timer_current)
+        if ((pd->queued) && (pd == pd->loop_data->timer_current))
           pd->loop_data->timer_current = (Efl_Loop_Timer_Data*)EINA_INLIST_GET(pd)->next;
-        pd->loop_data->timers = eina_inlist_remove(pd->loop_data->timers, EINA_INLIST_GET(pd));
+        _efl_loop_timer_unqueue(pd);
      }
-   else if (first == pd->loop_data->suspended)
-     pd->loop_data->suspended = eina_inlist_remove
-       (pd->loop_data->suspended, EINA_INLIST_GET(pd));
 
    if (efl_invalidated_get(obj)) return;
 
@@ -526,11 +562,9 @@ _efl_loop_timer_efl_object_destructor(Eo *obj, Efl_Loop_Timer_Data *pd)
 void
 _efl_loop_timer_enable_new(Eo *obj EINA_UNUSED, Efl_Loop_Data *pd)
 {
-   Efl_Loop_Timer_Data *timer;
-
    if (!pd->timers_added) return;
    pd->timers_added = 0;
-   EINA_INLIST_FOREACH(pd->timers, timer) timer->just_added = 0;
+   pd->timers_generation++;
 }
 
 int
@@ -546,7 +580,7 @@ _efl_loop_timer_first_get(Eo *ob EINA_UNUSED, Efl_Loop_Data *pd)
 
    EINA_INLIST_FOREACH(pd->timers, timer)
      {
-        if (!timer->just_added) return timer->object;
+        if (!_efl_loop_timer_just_added(timer)) return timer->object;
      }
    return NULL;
 }
@@ -562,7 +596,7 @@ _efl_loop_timer_after_get(Efl_Loop_Timer_Data *base)
      {
         if (EINA_UNLIKELY(!timer->initialized)) continue; // This shouldn't happen
         if (timer->at >= maxtime) break;
-        if (!timer->just_added) valid_timer = timer;
+        if (!_efl_loop_timer_just_added(timer)) valid_timer = timer;
      }
    return valid_timer;
 }
@@ -591,13 +625,8 @@ _efl_loop_timer_reschedule(Efl_Loop_Timer_Data *timer, double when)
    if (timer->frozen || efl_invalidated_get(timer->object) ||
        (timer->legacy && timer->legacy->delete_me)) return;
 
-   if (timer->loop_data &&
-       (EINA_INLIST_GET(timer)->next || EINA_INLIST_GET(timer)->prev))
-     {
-        if (timer->loop_data->timers && (!timer->noparent))
-          timer->loop_data->timers = eina_inlist_remove
-            (timer->loop_data->timers, EINA_INLIST_GET(timer));
-     }
+   if (timer->loop_data && timer->queued && (!timer->noparent))
+     _efl_loop_timer_unqueue(timer);
 
    /* if the timer would have gone off more than 15 seconds ago,
     * assume that the system hung and set the timer to go off
@@ -656,7 +685,7 @@ _efl_loop_timer_expired_call(Eo *obj EINA_UNUSED, Efl_Loop_Data *pd, double when
              return 0;
           }
 
-        if (timer->just_added)
+        if (_efl_loop_timer_just_added(timer))
           {
              pd->timer_current = (Efl_Loop_Timer_Data *)
                EINA_INLIST_GET(pd->timer_current)->next;
@@ -696,6 +725,7 @@ _efl_loop_timer_set(Efl_Loop_Timer_Data *timer, double at, double in)
    timer->loop_data->timers_added = 1;
    timer->in = in;
    timer->just_added = 1;
+   timer->added_generation = timer->loop_data->timers_generation;
    timer->initialized = 1;
    if (!timer->frozen)
      {
@@ -34,8 +34,32 @@
 #define DLT_R1     14
 #define DLT_R2     15
 
+/* Messages sent in one main loop iteration pile up in the input queue;
+ * moving them in big chunks turns them into a single write() on the socket
+ * and keeps large payloads from being split into many small reads.
+ */
+#define ECORE_IPC_COPIER_CHUNK_SIZE (64 * 1024)
+/* Largest incomplete message we allocate the whole buffer for up front */
+#define ECORE_IPC_BUF_PREALLOC_MAX (16 * 1024 * 1024)
+/* Part of the payload (1/n) that must have arrived before we do so */
+#define ECORE_IPC_BUF_PREALLOC_PART 4
+
 static int _ecore_ipc_log_dom = -1;
 
+/* Size to give the buffer holding the start of an incomplete message. The
+ * header alone is only the peer's word, so the whole message is allocated
+ * once a good part of its payload is actually there, and never when it is
+ * bigger than what would be delivered. Otherwise the buffer just grows with
+ * the data. */
+static int
+_ecore_ipc_buf_want_get(int have, int head_size, int msg_size, int max)
+{
+   if ((max >= 0) && (msg_size > max)) return 0;
+   if (msg_size > ECORE_IPC_BUF_PREALLOC_MAX) return 0;
+   if ((have - head_size) < (msg_size / ECORE_IPC_BUF_PREALLOC_PART)) return 0;
+   return head_size + msg_size;
+}
+
 /****** This swap function are around just for backward compatibility do not remove *******/
 EAPI unsigned short
 _ecore_ipc_swap_16(unsigned short v)
@@ -762,6 +786,7 @@ ecore_ipc_server_connect(Ecore_Ipc_Type type, char *name, int port, const void *
    svr->dialer.send_copier = efl_add(EFL_IO_COPIER_CLASS, loop,
                                      efl_io_closer_close_on_invalidate_set(efl_added, EINA_FALSE),
                                      efl_io_copier_source_set(efl_added, svr->dialer.input),
+                                     efl_io_copier_read_chunk_size_set(efl_added, ECORE_IPC_COPIER_CHUNK_SIZE),
                                      efl_io_copier_destination_set(efl_added, svr->dialer.dialer),
                                      efl_event_callback_array_add(efl_added, _ecore_ipc_dialer_copier_cbs(), svr));
    EINA_SAFETY_ON_NULL_GOTO(svr->dialer.send_copier, error);
@@ -769,6 +794,7 @@ ecore_ipc_server_connect(Ecore_Ipc_Type type, char *name, int port, const void *
    svr->dialer.recv_copier = efl_add(EFL_IO_COPIER_CLASS, loop,
                                      efl_io_closer_close_on_invalidate_set(efl_added, EINA_FALSE),
                                      efl_io_copier_source_set(efl_added, svr->dialer.dialer),
+                                     efl_io_copier_read_chunk_size_set(efl_added, ECORE_IPC_COPIER_CHUNK_SIZE),
                                      efl_event_callback_array_add(efl_added, _ecore_ipc_dialer_copier_cbs(), svr),
                                      efl_event_callback_add(efl_added, EFL_IO_COPIER_EVENT_DATA, _ecore_ipc_dialer_copier_data, svr));
    EINA_SAFETY_ON_NULL_GOTO(svr->dialer.recv_copier, error);
@@ -1353,6 +1379,7 @@ _ecore_ipc_server_client_add(void *data, const Efl_Event *event)
    cl->socket.send_copier = efl_add(EFL_IO_COPIER_CLASS, loop,
                                      efl_io_closer_close_on_invalidate_set(efl_added, EINA_FALSE),
                                      efl_io_copier_source_set(efl_added, cl->socket.input),
+                                     efl_io_copier_read_chunk_size_set(efl_added, ECORE_IPC_COPIER_CHUNK_SIZE),
                                      efl_io_copier_destination_set(efl_added, cl->socket.socket),
                                      efl_event_callback_array_add(efl_added, _ecore_ipc_client_socket_copier_cbs(), cl));
    EINA_SAFETY_ON_NULL_GOTO(cl->socket.send_copier, error);
@@ -1360,6 +1387,7 @@ _ecore_ipc_server_client_add(void *data, const Efl_Event *event)
    cl->socket.recv_copier = efl_add(EFL_IO_COPIER_CLASS, loop,
                                      efl_io_closer_close_on_invalidate_set(efl_added, EINA_FALSE),
                                      efl_io_copier_source_set(efl_added, cl->socket.socket),
+                                     efl_io_copier_read_chunk_size_set(efl_added, ECORE_IPC_COPIER_CHUNK_SIZE),
                                      efl_event_callback_array_add(efl_added, _ecore_ipc_client_socket_copier_cbs(), cl),
                                      efl_event_callback_add(efl_added, EFL_IO_COPIER_EVENT_DATA, _ecore_ipc_client_socket_copier_data, cl));
    EINA_SAFETY_ON_NULL_GOTO(cl->socket.recv_copier, error);
@@ -1545,26 +1573,33 @@ ecore_ipc_client_data_process(Ecore_Ipc_Client *cl, void *data, int size, Eina_B
    if (1)
      { /* keep same identation as original code to help verification */
         Ecore_Ipc_Msg_Head msg;
-        int offset = 0;
+        int offset = 0, want = 0;
         unsigned char *buf;
 
         if (!cl->buf)
           {
              cl->buf_size = e->size;
+             cl->buf_alloc = e->size;
              cl->buf = e->data;
              *stolen = EINA_TRUE;
           }
         else
           {
-             buf = realloc(cl->buf, cl->buf_size + e->size);
-             if (!buf)
+             /* the buffer may already be sized for the pending message */
+             if (cl->buf_size + e->size > cl->buf_alloc)
                {
-                  free(cl->buf);
-                  cl->buf = 0;
-                  cl->buf_size  = 0;
-                  return ECORE_CALLBACK_CANCEL;
+                  buf = realloc(cl->buf, cl->buf_size + e->size);
+                  if (!buf)
+                    {
+                       free(cl->buf);
+                       cl->buf = 0;
+                       cl->buf_size  = 0;
+                       cl->buf_alloc = 0;
+                       return ECORE_CALLBACK_CANCEL;
+                    }
+                  cl->buf = buf;
+                  cl->buf_alloc = cl->buf_size + e->size;
                }
-             cl->buf = buf;
              memcpy(cl->buf + cl->buf_size, e->data, e->size);
              cl->buf_size += e->size;
           }
@@ -1659,27 +1694,61 @@ ecore_ipc_client_data_process(Ecore_Ipc_Client *cl, void *data, int size, Eina_B
                        free(cl->buf);
                        cl->buf = NULL;
                        cl->buf_size = 0;
+                       cl->buf_alloc = 0;
                        return ECORE_CALLBACK_CANCEL;
                     }
                   goto redo;
                }
-             else goto scroll;
+             else
+               {
+                  int max = svr->max_buf_size, max2 = cl->max_buf_size;
+
+                  /* size the buffer for the whole message once instead of
+                   * growing it with every chunk that arrives */
+                  if ((max < 0) || ((max2 >= 0) && (max2 < max))) max = max2;
+                  want = _ecore_ipc_buf_want_get(cl->buf_size - offset, s,
+                                                 msg.size, max);
+                  goto scroll;
+               }
           }
         else
           {
              scroll:
-             buf = malloc(cl->buf_size - offset);
+             if (want < (cl->buf_size - offset))
+               want = cl->buf_size - offset;
+             if (offset == 0)
+               {
+                  /* nothing consumed, no need to move the data around */
+                  if (want > cl->buf_alloc)
+                    {
+                       buf = realloc(cl->buf, want);
+                       if (!buf)
+                         {
+                            free(cl->buf);
+                            cl->buf = NULL;
+                            cl->buf_size = 0;
+                            cl->buf_alloc = 0;
+                            return ECORE_CALLBACK_CANCEL;
+                         }
+                       cl->buf = buf;
+                       cl->buf_alloc = want;
+                    }
+                  return ECORE_CALLBACK_CANCEL;
+               }
+             buf = malloc(want);
              if (!buf)
                {
                   free(cl->buf);
                   cl->buf = NULL;
                   cl->buf_size = 0;
+                  cl->buf_alloc = 0;
                   return ECORE_CALLBACK_CANCEL;
                }
              memcpy(buf, cl->buf + offset, cl->buf_size - offset);
              free(cl->buf);
              cl->buf = buf;
              cl->buf_size -= offset;
+             cl->buf_alloc = want;
           }
      }
 
@@ -1736,26 +1805,33 @@ ecore_ipc_server_data_process(Ecore_Ipc_Server *svr, void *data, int size, Eina_
    if (1)
      { /* keep same identation as original code to help verification */
         Ecore_Ipc_Msg_Head msg;
-        int offset = 0;
+        int offset = 0, want = 0;
         unsigned char *buf = NULL;
 
         if (!svr->buf)
           {
              svr->buf_size = e->size;
+             svr->buf_alloc = e->size;
              svr->buf = e->data;
              *stolen = EINA_TRUE;
           }
         else
           {
-             buf = realloc(svr->buf, svr->buf_size + e->size);
-             if (!buf)
+             /* the buffer may already be sized for the pending message */
+             if (svr->buf_size + e->size > svr->buf_alloc)
                {
-                  free(svr->buf);
-                  svr->buf = 0;
-                  svr->buf_size  = 0;
-                  return ECORE_CALLBACK_CANCEL;
+                  buf = realloc(svr->buf, svr->buf_size + e->size);
+                  if (!buf)
+                    {
+                       free(svr->buf);
+                       svr->buf = 0;
+                       svr->buf_size  = 0;
+                       svr->buf_alloc = 0;
+                       return ECORE_CALLBACK_CANCEL;
+                    }
+                  svr->buf = buf;
+                  svr->buf_alloc = svr->buf_size + e->size;
                }
-             svr->buf = buf;
              memcpy(svr->buf + svr->buf_size, e->data, e->size);
              svr->buf_size += e->size;
           }
@@ -1829,6 +1905,7 @@ ecore_ipc_server_data_process(Ecore_Ipc_Server *svr, void *data, int size, Eina_
                                    {
                                       svr->buf = NULL;
                                       svr->buf_size = 0;
+                                      svr->buf_alloc = 0;
                                    }
                                  buf = NULL;
                                  ecore_event_add(ECORE_IPC_EVENT_SERVER_DATA, e2,
@@ -1854,28 +1931,59 @@ ecore_ipc_server_data_process(Ecore_Ipc_Server *svr, void *data, int size, Eina_
                        free(svr->buf);
                        svr->buf = NULL;
                        svr->buf_size = 0;
+                       svr->buf_alloc = 0;
                        return ECORE_CALLBACK_CANCEL;
                     }
                   goto redo;
                }
-             else goto scroll;
+             else
+               {
+                  /* size the buffer for the whole message once instead of
+                   * growing it with every chunk that arrives */
+                  want = _ecore_ipc_buf_want_get(svr->buf_size - offset, s,
+                                                 msg.size, svr->max_buf_size);
+                  goto scroll;
+               }
           }
         else
           {
              scroll:
              if (buf != svr->buf) free(buf);
-             buf = malloc(svr->buf_size - offset);
+             if (want < (svr->buf_size - offset))
+               want = svr->buf_size - offset;
+             if (offset == 0)
+               {
+                  /* nothing consumed, no need to move the data around */
+                  if (want > svr->buf_alloc)
+                    {
+                       buf = realloc(svr->buf, want);
+                       if (!buf)
+                         {
+                            free(svr->buf);
+                            svr->buf = NULL;
+                            svr->buf_size = 0;
+                            svr->buf_alloc = 0;
+                            return ECORE_CALLBACK_CANCEL;
+                         }
+                       svr->buf = buf;
+                       svr->buf_alloc = want;
+                    }
+                  return ECORE_CALLBACK_CANCEL;
+               }
+             buf = malloc(want);
              if (!buf)
                {
                   free(svr->buf);
                   svr->buf = NULL;
                   svr->buf_size = 0;
+                  svr->buf_alloc = 0;
                   return ECORE_CALLBACK_CANCEL;
                }
              memcpy(buf, svr->buf + offset, svr->buf_size - offset);
              free(svr->buf);
              svr->buf = buf;
              svr->buf_size -= offset;
+             svr->buf_alloc = want;
           }
      }
 
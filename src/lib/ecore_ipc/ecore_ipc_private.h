@@ -78,6 +78,7 @@ struct _Ecore_Ipc_Client
    void              *data;
    unsigned char     *buf;
    int                buf_size;
+   int                buf_alloc;
    int                max_buf_size;
 
    struct {
@@ -107,6 +108,7 @@ struct _Ecore_Ipc_Server
    void              *data;
    unsigned char     *buf;
    int                buf_size;
+   int                buf_alloc;
    int                max_buf_size;
 
    struct {
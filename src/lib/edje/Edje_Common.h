@@ -248,6 +248,39 @@ struct _Edje_Size_Class
  */
 EAPI void         edje_message_signal_process             (void);
 
+/**
+ * @brief Sets whether queued messages may be folded together.
+ *
+ * When enabled, a message sent to an object whose last queued message has
+ * the same queue, type and id replaces it instead of being queued too:
+ * an #EDJE_MESSAGE_INT or #EDJE_MESSAGE_FLOAT message only keeps the newest
+ * value, and a signal with no extra data identical to the pending one is
+ * delivered once. The folded message keeps the position of the pending one,
+ * so it may now be delivered before messages queued for other objects in
+ * between.
+ *
+ * Coalescing is opt-in. Each fold drops a delivery that a message handler
+ * or an embryo script may rely on, so no message is folded unless this is
+ * enabled. Setting EDJE_MESSAGE_COALESCE in the environment enables it at
+ * edje_init() time.
+ *
+ * @param coalesce @c EINA_TRUE to fold messages, @c EINA_FALSE otherwise.
+ *
+ * @see edje_message_coalesce_get()
+ * @since 1.29
+ */
+EAPI void         edje_message_coalesce_set               (Eina_Bool coalesce);
+
+/**
+ * @brief Gets whether queued messages may be folded together.
+ *
+ * @return @c EINA_TRUE if messages are folded, @c EINA_FALSE otherwise.
+ *
+ * @see edje_message_coalesce_set()
+ * @since 1.29
+ */
+EAPI Eina_Bool    edje_message_coalesce_get               (void);
+
 /**
  * @}
  */
@@ -92,6 +92,10 @@ EAPI Eina_Bool edje_object_preload(Evas_Object *obj, Eina_Bool cancel);
  * to match multiple signals at once. All the "*?[\" set of @c fnmatch()
  * operators can be used, both for emission and source.
  *
+ * When several callbacks match the same signal, the ones registered with a
+ * pattern are called first, then the ones registered with plain strings.
+ * Within each group, callbacks are called in the order they were added.
+ *
  * Edje has  internal signals it will emit, automatically, on various actions
  * taking place on group parts. For example, the mouse cursor being moved,
  * pressed, released, etc., over a given part's area, all generate individual
@@ -222,10 +222,12 @@ _edje_part_pos_set(Edje *ed, Edje_Real_Part *ep, int mode, FLOAT_T pos, FLOAT_T
 
    ep->description_pos = npos;
 
-   ed->dirty = EINA_TRUE;
    ed->recalc_call = EINA_TRUE;
 #ifdef EDJE_CALC_CACHE
+   ed->dirty_parts = EINA_TRUE;
    ep->invalidate = EINA_TRUE;
+#else
+   ed->dirty = EINA_TRUE;
 #endif
 }
 
@@ -872,10 +874,12 @@ _edje_part_description_apply(Edje *ed, Edje_Real_Part *ep, const char *d1, doubl
      }
 
    ed->recalc_hints = EINA_TRUE;
-   ed->dirty = EINA_TRUE;
    ed->recalc_call = EINA_TRUE;
 #ifdef EDJE_CALC_CACHE
+   ed->dirty_parts = EINA_TRUE;
    ep->invalidate = EINA_TRUE;
+#else
+   ed->dirty = EINA_TRUE;
 #endif
 }
 
@@ -903,6 +907,256 @@ _edje_recalc(Edje *ed)
    evas_object_smart_changed(ed->obj);
 }
 
+/* Part dependency graph.
+ *
+ * Built once per collection from every description of every part, so it
+ * holds whatever state the parts are in. It gives an order in which parts
+ * can be recalculated without having to recurse into what they depend on,
+ * and for each part the list of parts depending on it, so that when only
+ * a few parts changed we can limit the recalc to them and their dependents. */
+
+typedef struct _Edje_Calc_Dep Edje_Calc_Dep;
+struct _Edje_Calc_Dep
+{
+   unsigned short from;
+   unsigned short to;
+};
+
+static void
+_edje_calc_dep_add(Eina_Inarray *deps, int from, unsigned int to,
+                   unsigned int count)
+{
+   Edje_Calc_Dep dep;
+
+   if (from < 0) return;
+   from %= count;
+   if ((unsigned int)from == to) return;
+
+   dep.from = from;
+   dep.to = to;
+   eina_inarray_push(deps, &dep);
+}
+
+static void
+_edje_calc_deps_desc_add(Eina_Inarray *deps, const Edje_Part *part,
+                         const Edje_Part_Description_Common *desc,
+                         unsigned int to, unsigned int count)
+{
+   if (!desc) return;
+
+   _edje_calc_dep_add(deps, desc->rel1.id_x, to, count);
+   _edje_calc_dep_add(deps, desc->rel1.id_y, to, count);
+   _edje_calc_dep_add(deps, desc->rel2.id_x, to, count);
+   _edje_calc_dep_add(deps, desc->rel2.id_y, to, count);
+   _edje_calc_dep_add(deps, desc->clip_to_id, to, count);
+   if (desc->map.on)
+     {
+        _edje_calc_dep_add(deps, desc->map.rot.id_center, to, count);
+        _edje_calc_dep_add(deps, desc->map.zoom.id_center, to, count);
+        _edje_calc_dep_add(deps, desc->map.id_light, to, count);
+        _edje_calc_dep_add(deps, desc->map.id_persp, to, count);
+     }
+
+   switch (part->type)
+     {
+      case EDJE_PART_TYPE_TEXT:
+      case EDJE_PART_TYPE_TEXTBLOCK:
+        {
+           const Edje_Part_Description_Text *text = (const Edje_Part_Description_Text *)desc;
+
+           _edje_calc_dep_add(deps, text->text.id_source, to, count);
+           _edje_calc_dep_add(deps, text->text.id_text_source, to, count);
+           break;
+        }
+
+      case EDJE_PART_TYPE_PROXY:
+        _edje_calc_dep_add(deps, ((const Edje_Part_Description_Proxy *)desc)->proxy.id,
+                           to, count);
+        break;
+
+      default:
+        break;
+     }
+}
+
+static Eina_Bool
+_edje_collection_calc_deps_build(Edje_Part_Collection *ec)
+{
+   Eina_Inarray deps;
+   Edje_Calc_Dep *dep;
+   unsigned short *order = NULL;
+   unsigned short *dependents = NULL;
+   unsigned int *offsets = NULL;
+   unsigned int *pending = NULL;
+   unsigned int *fill = NULL;
+   unsigned int count = ec->parts_count;
+   unsigned int head = 0, tail = 0;
+   unsigned int i, j;
+
+   if (!count) return EINA_FALSE;
+
+   eina_inarray_step_set(&deps, sizeof (Eina_Inarray), sizeof (Edje_Calc_Dep), 64);
+
+   for (i = 0; i < count; i++)
+     {
+        const Edje_Part *part = ec->parts[i];
+
+        _edje_calc_dep_add(&deps, part->clip_to_id, i, count);
+        _edje_calc_dep_add(&deps, part->dragable.confine_id, i, count);
+        _edje_calc_dep_add(&deps, part->dragable.threshold_id, i, count);
+
+        _edje_calc_deps_desc_add(&deps, part, part->default_desc, i, count);
+        for (j = 0; j < part->other.desc_count; j++)
+          _edje_calc_deps_desc_add(&deps, part, part->other.desc[j], i, count);
+     }
+
+   order = malloc(count * sizeof (unsigned short));
+   offsets = calloc(count + 1, sizeof (unsigned int));
+   pending = calloc(count, sizeof (unsigned int));
+   fill = malloc(count * sizeof (unsigned int));
+   dependents = malloc((eina_inarray_count(&deps) + 1) * sizeof (unsigned short));
+   if (!order || !offsets || !pending || !fill || !dependents) goto on_error;
+
+   EINA_INARRAY_FOREACH(&deps, dep)
+     {
+        offsets[dep->from + 1]++;
+        pending[dep->to]++;
+     }
+   for (i = 0; i < count; i++)
+     {
+        offsets[i + 1] += offsets[i];
+        fill[i] = offsets[i];
+     }
+   EINA_INARRAY_FOREACH(&deps, dep)
+     dependents[fill[dep->from]++] = dep->to;
+
+   for (i = 0; i < count; i++)
+     if (!pending[i]) order[tail++] = i;
+
+   while (head < tail)
+     {
+        unsigned int p = order[head++];
+
+        for (j = offsets[p]; j < offsets[p + 1]; j++)
+          if (!--pending[dependents[j]])
+            order[tail++] = dependents[j];
+     }
+
+   /* Whatever is left is part of, or depends on, a circular dependency.
+    * _edje_part_recalc() will complain about it, just keep them around. */
+   for (i = 0; (i < count) && (tail < count); i++)
+     if (pending[i]) order[tail++] = i;
+
+   free(pending);
+   free(fill);
+   eina_inarray_flush(&deps);
+
+   ec->calc.order = order;
+   ec->calc.dependents = dependents;
+   ec->calc.dependents_offset = offsets;
+   return EINA_TRUE;
+
+on_error:
+   free(order);
+   free(offsets);
+   free(pending);
+   free(fill);
+   free(dependents);
+   eina_inarray_flush(&deps);
+   return EINA_FALSE;
+}
+
+void
+_edje_collection_calc_deps_free(Edje_Part_Collection *ec)
+{
+   free(ec->calc.order);
+   free(ec->calc.dependents);
+   free(ec->calc.dependents_offset);
+   ec->calc.order = NULL;
+   ec->calc.dependents = NULL;
+   ec->calc.dependents_offset = NULL;
+}
+
+static const unsigned short *
+_edje_recalc_order_get(Edje *ed)
+{
+   Edje_Part_Collection *ec = ed->collection;
+
+   if (!ec || ec->calc.disabled) return NULL;
+   if (ec->parts_count != ed->table_parts_size) return NULL;
+   if (!ec->calc.order && !_edje_collection_calc_deps_build(ec))
+     {
+        ec->calc.disabled = EINA_TRUE;
+        return NULL;
+     }
+
+   return ec->calc.order;
+}
+
+#ifdef EDJE_CALC_CACHE
+/* Custom states are built at runtime by embryo and can point their
+ * relations at any part, so the graph knows nothing about them. */
+static Eina_Bool
+_edje_recalc_custom_in_use(const Edje *ed)
+{
+   unsigned short i;
+   Edje_Real_Part *ep;
+
+   for (i = 0; i < ed->table_parts_size; i++)
+     {
+        ep = ed->table_parts[i];
+        if ((!ep->custom) || (!ep->custom->description)) continue;
+        if ((ep->param1.description == ep->custom->description) ||
+            ((ep->param2) &&
+             (ep->param2->description == ep->custom->description)))
+          return EINA_TRUE;
+     }
+   return EINA_FALSE;
+}
+
+/* Only the parts that were invalidated, and the ones depending on them,
+ * need to go through _edje_part_recalc(). Everything else is marked as
+ * already calculated so the recursion stops on them too. */
+static void
+_edje_recalc_table_parts_partial(Edje *ed, const unsigned short *order)
+{
+   const Edje_Part_Collection *ec = ed->collection;
+   unsigned short i;
+   unsigned int j;
+   Edje_Real_Part *ep;
+
+   for (i = 0; i < ed->table_parts_size; i++)
+     {
+        ep = ed->table_parts[i];
+        ep->calculating = FLAG_NONE;
+        if (ep->invalidate ||
+            (ed->text_part_change &&
+             ((ep->part->type == EDJE_PART_TYPE_TEXT) ||
+              (ep->part->type == EDJE_PART_TYPE_TEXTBLOCK)))
+#ifdef HAVE_EPHYSICS
+            || ep->part->physics_body || ep->body
+#endif
+           )
+          ep->calculated = FLAG_NONE;
+        else
+          ep->calculated = FLAG_XY;
+     }
+
+   for (i = 0; i < ed->table_parts_size; i++)
+     {
+        ep = ed->table_parts[order[i]];
+        if (ep->calculated == FLAG_XY) continue;
+
+        for (j = ec->calc.dependents_offset[order[i]];
+             j < ec->calc.dependents_offset[order[i] + 1]; j++)
+          ed->table_parts[ec->calc.dependents[j]]->calculated = FLAG_NONE;
+
+        _edje_part_recalc(ed, ep, (~ep->calculated) & FLAG_XY, NULL);
+     }
+}
+
+#endif
+
 static
 #ifdef EDJE_CALC_CACHE
 Eina_Bool
@@ -912,12 +1166,25 @@ void
 _edje_recalc_table_parts(Edje *ed
 #ifdef EDJE_CALC_CACHE
                          , Eina_Bool need_reinit_state
+                         , Eina_Bool partial
 #endif
                         )
 {
+   const unsigned short *order;
    unsigned short i;
    Edje_Real_Part *ep;
 
+   order = _edje_recalc_order_get(ed);
+#ifdef EDJE_CALC_CACHE
+   if (order && partial && !need_reinit_state &&
+       !ed->all_part_change && !ed->need_map_update && !ed->calc_only &&
+       !_edje_recalc_custom_in_use(ed))
+     {
+        _edje_recalc_table_parts_partial(ed, order);
+        return need_reinit_state;
+     }
+#endif
+
    for (i = 0; i < ed->table_parts_size; i++)
      {
         ep = ed->table_parts[i];
@@ -934,7 +1201,7 @@ _edje_recalc_table_parts(Edje *ed
      }
    for (i = 0; i < ed->table_parts_size; i++)
      {
-        ep = ed->table_parts[i];
+        ep = ed->table_parts[order ? order[i] : i];
 
         if (ep->calculated != FLAG_XY) // FIXME: this is always true (see for above)
           _edje_part_recalc(ed, ep, (~ep->calculated) & FLAG_XY, NULL);
@@ -951,13 +1218,21 @@ _edje_recalc_do(Edje *ed)
    Eina_Bool need_calc;
 #ifdef EDJE_CALC_CACHE
    Eina_Bool need_reinit_state = EINA_FALSE;
+   Eina_Bool partial;
 #endif
 
    ed->has_size = EINA_TRUE;
 
    need_calc = evas_object_smart_need_recalculate_get(ed->obj);
    evas_object_smart_need_recalculate_set(ed->obj, 0);
+#ifdef EDJE_CALC_CACHE
+   if (!ed->dirty && !ed->dirty_parts) return;
+   /* Nothing but tracked part changes, only recalc what depends on them */
+   partial = !ed->dirty;
+   ed->dirty_parts = EINA_FALSE;
+#else
    if (!ed->dirty) return;
+#endif
    ed->dirty = EINA_FALSE;
    ed->state++;
 
@@ -977,6 +1252,7 @@ _edje_recalc_do(Edje *ed)
        _edje_recalc_table_parts(ed
 #ifdef EDJE_CALC_CACHE
                                 , need_reinit_state
+                                , partial
 #endif
                                );
 
@@ -249,6 +249,12 @@ _edje_edit_efl_file_load(Eo *obj, Edje_Edit *eed)
 
    err = efl_file_load(efl_super(obj, MY_CLASS));
    if (err) return err;
+   /* Parts and their relations can change under our feet from now on */
+   if (eed->base->collection)
+     {
+        _edje_collection_calc_deps_free(eed->base->collection);
+        eed->base->collection->calc.disabled = EINA_TRUE;
+     }
    /* TODO and maybes:
     *  * The whole point of this thing is keep track of stuff such as
     *    strings to free and who knows what, so we need to take care
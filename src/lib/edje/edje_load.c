@@ -2346,6 +2346,7 @@ _edje_collection_free(Edje_File *edf, Edje_Part_Collection *ec, Edje_Part_Collec
    unsigned int i;
 
    _edje_embryo_script_shutdown(ec);
+   _edje_collection_calc_deps_free(ec);
 
 #define EDJE_LOAD_PROGRAM_FREE(Array, Ec, It, FreeStrings)    \
   for (It = 0; It < Ec->programs.Array##_count; ++It)         \
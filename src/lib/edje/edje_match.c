@@ -245,6 +245,381 @@ _edje_match_patterns_exec_init_states(Edje_States *states,
      }
 }
 
+/* Lazily built DFA.
+ *
+ * Every DFA state is the (star-closed) set of NFA states reached by the
+ * prefix read so far. Transitions are computed on first use and kept, so
+ * once a signal has been seen it is matched in one pass over its characters
+ * without touching the patterns again. Characters are folded into classes
+ * that no pattern can tell apart to keep the transition tables small. If the
+ * automaton grows too large or a pattern is malformed we stop extending it
+ * and fall back to the NFA above. */
+
+#define EDJE_MATCH_DFA_STATES_MAX 512
+
+typedef struct _Edje_Dfa_State Edje_Dfa_State;
+struct _Edje_Dfa_State
+{
+   Edje_Dfa_State **next;
+   unsigned int    *matches;
+   unsigned int     matches_count;
+   unsigned int     size;
+   Edje_State       states[];
+};
+
+struct _Edje_Dfa
+{
+   Eina_Hash      *states;
+   Edje_Dfa_State *start;
+
+   unsigned int    states_count;
+   unsigned int    classes_count;
+   Eina_Bool       failed : 1;
+
+   unsigned char   classes[256];
+   unsigned char   reps[256];
+};
+
+static unsigned int
+_edje_dfa_state_key_length(const void *key EINA_UNUSED)
+{
+   return sizeof (Edje_Dfa_State);
+}
+
+static int
+_edje_dfa_state_key_cmp(const void *key1, int key1_length EINA_UNUSED,
+                        const void *key2, int key2_length EINA_UNUSED)
+{
+   const Edje_Dfa_State *a = key1;
+   const Edje_Dfa_State *b = key2;
+
+   if (a->size != b->size) return a->size > b->size ? 1 : -1;
+   return memcmp(a->states, b->states, a->size * sizeof (Edje_State));
+}
+
+static int
+_edje_dfa_state_key_hash(const void *key, int key_length EINA_UNUSED)
+{
+   const Edje_Dfa_State *a = key;
+
+   if (!a->size) return 0;
+   return eina_hash_superfast((const char *)a->states,
+                              a->size * sizeof (Edje_State));
+}
+
+static void
+_edje_dfa_state_free(void *data)
+{
+   Edje_Dfa_State *st = data;
+
+   free(st->next);
+   free(st->matches);
+   free(st);
+}
+
+static void
+_edje_dfa_classes_mark(Eina_Bool *bounds, char first, char last)
+{
+   bounds[(unsigned char)first] = EINA_TRUE;
+   bounds[(unsigned int)(unsigned char)last + 1] = EINA_TRUE;
+}
+
+/* Walk a pattern the same way the token functions do and record every
+ * character (or range edge) it tests, so that two characters between the
+ * same bounds always behave the same. */
+static void
+_edje_dfa_classes_collect(Eina_Bool *bounds, const char *p)
+{
+   while (*p)
+     {
+        switch (*p)
+          {
+           case '*':
+           case '?':
+             p++;
+             break;
+
+           case '\\':
+             if (!p[1]) return;
+             _edje_dfa_classes_mark(bounds, p[1], p[1]);
+             p += 2;
+             break;
+
+           case '[':
+             p++;
+             if (*p == '!') p++;
+             do
+               {
+                  if (!*p) return;
+                  if (p[1] == '-' && p[2] != ']')
+                    {
+                       if (!p[2]) return;
+                       _edje_dfa_classes_mark(bounds, p[0], p[2]);
+                       p += 3;
+                    }
+                  else
+                    {
+                       _edje_dfa_classes_mark(bounds, *p, *p);
+                       p++;
+                    }
+               }
+             while (*p && *p != ']');
+             if (!*p) return;
+             p++;
+             break;
+
+           default:
+             _edje_dfa_classes_mark(bounds, *p, *p);
+             p++;
+             break;
+          }
+     }
+}
+
+static int
+_edje_dfa_nfa_state_cmp(const void *a, const void *b)
+{
+   const Edje_State *sa = a;
+   const Edje_State *sb = b;
+
+   if (sa->idx != sb->idx) return sa->idx > sb->idx ? 1 : -1;
+   if (sa->pos != sb->pos) return sa->pos > sb->pos ? 1 : -1;
+   return 0;
+}
+
+/* Take ownership of a raw NFA state set, close it over '*', and return the
+ * matching DFA state, creating it if needed. */
+static Edje_Dfa_State *
+_edje_dfa_state_get(const Edje_Patterns *ppat, Edje_Dfa *dfa,
+                    Edje_State *set, unsigned int size, unsigned int alloc)
+{
+   Edje_Dfa_State *st, *found;
+   unsigned int i, j;
+
+   for (i = 0; i < size; ++i)
+     {
+        if (ppat->patterns[set[i].idx][set[i].pos] != '*') continue;
+
+        if (size == alloc)
+          {
+             Edje_State *tmp;
+
+             alloc *= 2;
+             tmp = realloc(set, alloc * sizeof (Edje_State));
+             if (!tmp) goto on_error;
+             set = tmp;
+          }
+        set[size].idx = set[i].idx;
+        set[size].pos = set[i].pos + 1;
+        size++;
+     }
+
+   if (size > 1)
+     {
+        qsort(set, size, sizeof (Edje_State), _edje_dfa_nfa_state_cmp);
+        for (i = 1, j = 0; i < size; ++i)
+          if (_edje_dfa_nfa_state_cmp(set + i, set + j))
+            set[++j] = set[i];
+        size = j + 1;
+     }
+
+   st = malloc(sizeof (Edje_Dfa_State) + size * sizeof (Edje_State));
+   if (!st) goto on_error;
+   st->size = size;
+   if (size) memcpy(st->states, set, size * sizeof (Edje_State));
+   free(set);
+   set = NULL;
+
+   found = eina_hash_find(dfa->states, st);
+   if (found)
+     {
+        free(st);
+        return found;
+     }
+
+   if (dfa->states_count >= EDJE_MATCH_DFA_STATES_MAX)
+     {
+        free(st);
+        goto on_fail;
+     }
+
+   st->next = calloc(dfa->classes_count, sizeof (Edje_Dfa_State *));
+   st->matches = malloc((size ? size : 1) * sizeof (unsigned int));
+   st->matches_count = 0;
+   if (!st->next || !st->matches)
+     {
+        _edje_dfa_state_free(st);
+        goto on_fail;
+     }
+
+   /* States are sorted by pattern, so accepted patterns come out sorted
+    * and we only have to skip repeats of the last one. */
+   for (i = 0; i < size; ++i)
+     {
+        const unsigned int idx = st->states[i].idx;
+
+        if (st->states[i].pos < ppat->finals[idx]) continue;
+        if (st->matches_count && st->matches[st->matches_count - 1] == idx)
+          continue;
+        st->matches[st->matches_count++] = idx;
+     }
+
+   if (!eina_hash_direct_add(dfa->states, st, st))
+     {
+        _edje_dfa_state_free(st);
+        goto on_fail;
+     }
+   dfa->states_count++;
+
+   return st;
+
+on_error:
+   free(set);
+on_fail:
+   dfa->failed = EINA_TRUE;
+   return NULL;
+}
+
+static Edje_Dfa_State *
+_edje_dfa_step(const Edje_Patterns *ppat, Edje_Dfa *dfa,
+               Edje_Dfa_State *from, unsigned char cls)
+{
+   Edje_Dfa_State *to;
+   Edje_State *set;
+   const char c = (char)dfa->reps[cls];
+   unsigned int size = 0;
+   unsigned int i;
+
+   set = malloc((from->size ? from->size : 1) * sizeof (Edje_State));
+   if (!set) goto on_fail;
+
+   for (i = 0; i < from->size; ++i)
+     {
+        const unsigned int idx = from->states[i].idx;
+        const unsigned int pos = from->states[i].pos;
+        unsigned int m;
+
+        if (!ppat->patterns[idx][pos])
+          continue;
+        else if (ppat->patterns[idx][pos] == '*')
+          m = 0;
+        else if (_edje_match_patterns_exec_token(ppat->patterns[idx] + pos,
+                                                 c, &m) != EDJE_MATCH_OK)
+          {
+             free(set);
+             goto on_fail;
+          }
+        else if (!m)
+          continue;
+
+        set[size].idx = idx;
+        set[size].pos = pos + m;
+        size++;
+     }
+
+   to = _edje_dfa_state_get(ppat, dfa, set, size,
+                            from->size ? from->size : 1);
+   if (to) from->next[cls] = to;
+   return to;
+
+on_fail:
+   dfa->failed = EINA_TRUE;
+   return NULL;
+}
+
+static Edje_Dfa *
+_edje_dfa_new(const Edje_Patterns *ppat)
+{
+   Eina_Bool bounds[257] = { 0 };
+   Edje_Dfa *dfa;
+   Edje_State *set;
+   unsigned int i;
+   int cls = -1;
+
+   dfa = calloc(1, sizeof (Edje_Dfa));
+   if (!dfa) return NULL;
+
+   /* Split at 0 and 128 too so ranges behave the same whether char is
+    * signed or not on this platform. */
+   bounds[0] = EINA_TRUE;
+   bounds[128] = EINA_TRUE;
+   for (i = 0; i < ppat->patterns_size; ++i)
+     _edje_dfa_classes_collect(bounds, ppat->patterns[i]);
+
+   for (i = 0; i < 256; ++i)
+     {
+        if (bounds[i])
+          {
+             cls++;
+             dfa->reps[cls] = i;
+          }
+        dfa->classes[i] = cls;
+     }
+   dfa->classes_count = cls + 1;
+
+   dfa->states = eina_hash_new(EINA_KEY_LENGTH(_edje_dfa_state_key_length),
+                               EINA_KEY_CMP(_edje_dfa_state_key_cmp),
+                               EINA_KEY_HASH(_edje_dfa_state_key_hash),
+                               _edje_dfa_state_free,
+                               5);
+   if (!dfa->states) goto on_error;
+
+   set = malloc(ppat->patterns_size * sizeof (Edje_State));
+   if (!set) goto on_error;
+   for (i = 0; i < ppat->patterns_size; ++i)
+     {
+        set[i].idx = i;
+        set[i].pos = 0;
+     }
+
+   dfa->start = _edje_dfa_state_get(ppat, dfa, set, ppat->patterns_size,
+                                    ppat->patterns_size);
+   if (!dfa->start) goto on_error;
+
+   return dfa;
+
+on_error:
+   if (dfa->states) eina_hash_free(dfa->states);
+   free(dfa);
+   return NULL;
+}
+
+static void
+_edje_dfa_free(Edje_Dfa *dfa)
+{
+   if (!dfa) return;
+   eina_hash_free(dfa->states);
+   free(dfa);
+}
+
+/* Returns the state reached after reading string, or NULL when the caller
+ * has to use the NFA instead. */
+static const Edje_Dfa_State *
+_edje_match_dfa_exec(const Edje_Patterns *ppat, const char *string)
+{
+   Edje_Dfa *dfa = ppat->dfa;
+   Edje_Dfa_State *st;
+   const unsigned char *c;
+
+   if (!dfa || dfa->failed) return NULL;
+
+   st = dfa->start;
+   for (c = (const unsigned char *)string; *c && st->size; ++c)
+     {
+        const unsigned char cls = dfa->classes[*c];
+        Edje_Dfa_State *next = st->next[cls];
+
+        if (!next)
+          {
+             next = _edje_dfa_step(ppat, dfa, st, cls);
+             if (!next) return NULL;
+          }
+        st = next;
+     }
+
+   return st;
+}
+
 /* Exported function. */
 
 #define EDJE_MATCH_INIT_LIST(Func, Type, Source, Show)              \
@@ -310,6 +685,7 @@ _edje_match_patterns_exec_init_states(Edje_States *states,
           free(r);                                                  \
           return NULL;                                              \
        }                                                            \
+     r->dfa = NULL;                                                 \
                                                                     \
      return r;                                                      \
   }
@@ -373,6 +749,7 @@ _edje_match_patterns_exec_init_states(Edje_States *states,
           free(r);                                                  \
           return NULL;                                              \
        }                                                            \
+     r->dfa = _edje_dfa_new(r);                                     \
                                                                     \
      return r;                                                      \
   }
@@ -433,6 +810,7 @@ _edje_match_patterns_exec_init_states(Edje_States *states,
           free(r);                                                             \
           return NULL;                                                         \
        }                                                                       \
+     r->dfa = _edje_dfa_new(r);                                                \
                                                                                \
      return r;                                                                 \
   }
@@ -465,41 +843,85 @@ _edje_match_collection_dir_exec_finals(const unsigned int *finals,
    return EINA_FALSE;
 }
 
-static Eina_Bool
-edje_match_programs_exec_check_finals(const unsigned int *signal_finals,
-                                      const unsigned int *source_finals,
-                                      const Edje_States *signal_states,
-                                      const Edje_States *source_states,
-                                      Edje_Program **programs,
-                                      Eina_Bool (*func)(Edje_Program *pr, void *data),
-                                      void *data,
-                                      Eina_Bool prop EINA_UNUSED)
+static int
+_edje_match_uint_cmp(const void *a, const void *b)
 {
-   unsigned int i;
-   unsigned int j;
+   const unsigned int ia = *(const unsigned int *)a;
+   const unsigned int ib = *(const unsigned int *)b;
 
+   if (ia != ib) return ia > ib ? 1 : -1;
+   return 0;
+}
+
+/* Patterns accepted by a NFA run, sorted and without repeats like the
+ * matches of a DFA state, so that both report them in the same order. */
+static unsigned int *
+_edje_match_states_matches_get(const unsigned int *finals,
+                               const Edje_States *states,
+                               unsigned int *count)
+{
+   unsigned int *matches;
+   unsigned int i, j;
+
+   *count = 0;
    /* when not enough memory, they could be NULL */
-   if (!signal_finals || !source_finals) return EINA_TRUE;
+   if (!finals) return NULL;
+   matches = malloc((states->size ? states->size : 1) * sizeof (unsigned int));
+   if (!matches) return NULL;
+
+   for (i = 0, j = 0; i < states->size; ++i)
+     if (states->states[i].pos >= finals[states->states[i].idx])
+       matches[j++] = states->states[i].idx;
+
+   if (j > 1)
+     {
+        unsigned int k;
+
+        qsort(matches, j, sizeof (unsigned int), _edje_match_uint_cmp);
+        for (i = 1, k = 0; i < j; ++i)
+          if (matches[i] != matches[k])
+            matches[++k] = matches[i];
+        j = k + 1;
+     }
+
+   *count = j;
+   return matches;
+}
+
+/* Programs matching both the signal and the source are reported in pattern
+ * order, whether the DFA or the NFA found them. */
+static Eina_Bool
+_edje_match_programs_matches_run(const unsigned int *signal_matches,
+                                 unsigned int signal_count,
+                                 const unsigned int *source_matches,
+                                 unsigned int source_count,
+                                 Edje_Program **programs,
+                                 Eina_Bool (*func)(Edje_Program *pr, void *data),
+                                 void *data)
+{
+   unsigned int i = 0;
+   unsigned int j = 0;
 
-   for (i = 0; i < signal_states->size; ++i)
+   while (i < signal_count && j < source_count)
      {
-        if (signal_states->states[i].pos >= signal_finals[signal_states->states[i].idx])
+        const unsigned int idx = signal_matches[i];
+
+        if (idx < source_matches[j])
+          i++;
+        else if (idx > source_matches[j])
+          j++;
+        else
           {
-             for (j = 0; j < source_states->size; ++j)
+             Edje_Program *pr;
+
+             pr = programs[idx];
+             if (pr)
                {
-                  if (signal_states->states[i].idx == source_states->states[j].idx
-                      && source_states->states[j].pos >= source_finals[source_states->states[j].idx])
-                    {
-                       Edje_Program *pr;
-
-                       pr = programs[signal_states->states[i].idx];
-                       if (pr)
-                         {
-                            if (func(pr, data))
-                              return EINA_FALSE;
-                         }
-                    }
+                  if (func(pr, data))
+                    return EINA_FALSE;
                }
+             i++;
+             j++;
           }
      }
 
@@ -507,47 +929,19 @@ edje_match_programs_exec_check_finals(const unsigned int *signal_finals,
 }
 
 static int
-edje_match_callback_exec_check_finals(const Edje_Signals_Sources_Patterns *ssp,
-                                      const Edje_Signal_Callback_Match *matches,
-                                      const Edje_States *signal_states,
-                                      const Edje_States *source_states,
-                                      const char *sig,
-                                      const char *source,
-                                      Edje *ed,
-                                      Eina_Bool prop)
+_edje_match_callback_run(const Edje_Signals_Sources_Patterns *ssp,
+                         const Edje_Signal_Callback_Match *matches,
+                         Eina_Array *run,
+                         const char *sig,
+                         const char *source,
+                         Edje *ed)
 {
    const Edje_Signal_Callback_Match *cb;
-   Eina_Array run;
+   Eina_Array_Iterator iterator;
    unsigned int i;
-   unsigned int j;
-   int r = 1;
-
-   eina_array_step_set(&run, sizeof (Eina_Array), 4);
+   int r = eina_array_count(run) ? 2 : 1;
 
-   for (i = 0; i < signal_states->size; ++i)
-     if (signal_states->states[i].pos >= ssp->signals_patterns->finals[signal_states->states[i].idx])
-       {
-          for (j = 0; j < source_states->size; ++j)
-            {
-               if (signal_states->states[i].idx == source_states->states[j].idx
-                   && source_states->states[j].pos >= ssp->sources_patterns->finals[source_states->states[j].idx])
-                 {
-                    int *e;
-
-                    e = eina_inarray_nth(&ssp->u.callbacks.globing, signal_states->states[i].idx);
-
-                    cb = &matches[*e];
-                    if (cb)
-                      {
-                         if ((prop) && ed->callbacks->flags[*e].propagate) continue;
-                         eina_array_push(&run, cb);
-                         r = 2;
-                      }
-                 }
-            }
-       }
-
-   while ((cb = eina_array_pop(&run)))
+   EINA_ARRAY_ITER_NEXT(run, i, cb, iterator)
      {
         int idx = cb - matches;
 
@@ -569,11 +963,54 @@ edje_match_callback_exec_check_finals(const Edje_Signals_Sources_Patterns *ssp,
           }
      }
 
-   eina_array_flush(&run);
+   eina_array_flush(run);
 
    return r;
 }
 
+/* Callbacks matching both the signal and the source are run in pattern
+ * order, which is the order they were added in. */
+static int
+_edje_match_callback_matches_run(const Edje_Signals_Sources_Patterns *ssp,
+                                 const Edje_Signal_Callback_Match *matches,
+                                 const unsigned int *signal_matches,
+                                 unsigned int signal_count,
+                                 const unsigned int *source_matches,
+                                 unsigned int source_count,
+                                 const char *sig,
+                                 const char *source,
+                                 Edje *ed,
+                                 Eina_Bool prop)
+{
+   Eina_Array run;
+   unsigned int i = 0;
+   unsigned int j = 0;
+
+   eina_array_step_set(&run, sizeof (Eina_Array), 4);
+
+   while (i < signal_count && j < source_count)
+     {
+        const unsigned int idx = signal_matches[i];
+
+        if (idx < source_matches[j])
+          i++;
+        else if (idx > source_matches[j])
+          j++;
+        else
+          {
+             int *e;
+
+             e = eina_inarray_nth(&ssp->u.callbacks.globing, idx);
+             if (!((prop) && ed->callbacks->flags[*e].propagate))
+               eina_array_push(&run, &matches[*e]);
+             i++;
+             j++;
+          }
+     }
+
+   return _edje_match_callback_run(ssp, matches, &run, sig, source, ed);
+}
+
 static Edje_States *
 _edje_match_fn(const Edje_Patterns *ppat,
                const char *string,
@@ -652,8 +1089,10 @@ edje_match_programs_exec(const Edje_Patterns *ppat_signal,
                          Edje_Program **programs,
                          Eina_Bool (*func)(Edje_Program *pr, void *data),
                          void *data,
-                         Eina_Bool prop)
+                         Eina_Bool prop EINA_UNUSED)
 {
+   const Edje_Dfa_State *signal_state;
+   const Edje_Dfa_State *source_state;
    Edje_States *signal_result;
    Edje_States *source_result;
    Eina_Bool r = EINA_FALSE;
@@ -661,6 +1100,17 @@ edje_match_programs_exec(const Edje_Patterns *ppat_signal,
    /* under high memory presure, they could be NULL */
    if (!ppat_source || !ppat_signal) return EINA_FALSE;
 
+   signal_state = _edje_match_dfa_exec(ppat_signal, sig);
+   source_state = signal_state ? _edje_match_dfa_exec(ppat_source, source) : NULL;
+   if (signal_state && source_state)
+     return _edje_match_programs_matches_run(signal_state->matches,
+                                             signal_state->matches_count,
+                                             source_state->matches,
+                                             source_state->matches_count,
+                                             programs,
+                                             func,
+                                             data);
+
    _edje_match_patterns_exec_init_states(ppat_signal->states,
                                          ppat_signal->patterns_size,
                                          ppat_signal->max_length);
@@ -672,14 +1122,29 @@ edje_match_programs_exec(const Edje_Patterns *ppat_signal,
    source_result = _edje_match_fn(ppat_source, source, ppat_source->states);
 
    if (signal_result && source_result)
-     r = edje_match_programs_exec_check_finals(ppat_signal->finals,
-                                               ppat_source->finals,
-                                               signal_result,
-                                               source_result,
+     {
+        unsigned int *signal_matches, *source_matches;
+        unsigned int signal_count, source_count;
+
+        signal_matches = _edje_match_states_matches_get(ppat_signal->finals,
+                                                        signal_result,
+                                                        &signal_count);
+        source_matches = _edje_match_states_matches_get(ppat_source->finals,
+                                                        source_result,
+                                                        &source_count);
+        if (!signal_matches || !source_matches)
+          r = EINA_TRUE;
+        else
+          r = _edje_match_programs_matches_run(signal_matches,
+                                               signal_count,
+                                               source_matches,
+                                               source_count,
                                                programs,
                                                func,
-                                               data,
-                                               prop);
+                                               data);
+        free(signal_matches);
+        free(source_matches);
+     }
    return r;
 }
 
@@ -691,6 +1156,8 @@ edje_match_callback_exec(const Edje_Signals_Sources_Patterns *ssp,
                          Edje *ed,
                          Eina_Bool prop)
 {
+   const Edje_Dfa_State *signal_state;
+   const Edje_Dfa_State *source_state;
    Edje_States *signal_result;
    Edje_States *source_result;
    int r = 0;
@@ -700,6 +1167,24 @@ edje_match_callback_exec(const Edje_Signals_Sources_Patterns *ssp,
 
    ssp->signals_patterns->ref++;
    ssp->sources_patterns->ref++;
+
+   signal_state = _edje_match_dfa_exec(ssp->signals_patterns, sig);
+   source_state = signal_state ? _edje_match_dfa_exec(ssp->sources_patterns, source) : NULL;
+   if (signal_state && source_state)
+     {
+        r = _edje_match_callback_matches_run(ssp,
+                                             matches,
+                                             signal_state->matches,
+                                             signal_state->matches_count,
+                                             source_state->matches,
+                                             source_state->matches_count,
+                                             sig,
+                                             source,
+                                             ed,
+                                             prop);
+        goto end;
+     }
+
    _edje_match_patterns_exec_init_states(ssp->signals_patterns->states,
                                          ssp->signals_patterns->patterns_size,
                                          ssp->signals_patterns->max_length);
@@ -711,14 +1196,32 @@ edje_match_callback_exec(const Edje_Signals_Sources_Patterns *ssp,
    source_result = _edje_match_fn(ssp->sources_patterns, source, ssp->sources_patterns->states);
 
    if (signal_result && source_result)
-     r = edje_match_callback_exec_check_finals(ssp,
+     {
+        unsigned int *signal_matches, *source_matches;
+        unsigned int signal_count, source_count;
+
+        signal_matches = _edje_match_states_matches_get(ssp->signals_patterns->finals,
+                                                        signal_result,
+                                                        &signal_count);
+        source_matches = _edje_match_states_matches_get(ssp->sources_patterns->finals,
+                                                        source_result,
+                                                        &source_count);
+        if (signal_matches && source_matches)
+          r = _edje_match_callback_matches_run(ssp,
                                                matches,
-                                               signal_result,
-                                               source_result,
+                                               signal_matches,
+                                               signal_count,
+                                               source_matches,
+                                               source_count,
                                                sig,
                                                source,
                                                ed,
                                                prop);
+        free(signal_matches);
+        free(source_matches);
+     }
+
+end:
    ssp->signals_patterns->ref--;
    ssp->sources_patterns->ref--;
    if (ssp->signals_patterns->ref <= 0) edje_match_patterns_free(ssp->signals_patterns);
@@ -735,6 +1238,7 @@ edje_match_patterns_free(Edje_Patterns *ppat)
    ppat->ref--;
    if (ppat->ref > 0) return;
    _edje_match_states_free(ppat->states, 2);
+   _edje_dfa_free(ppat->dfa);
    free(ppat);
 }
 
@@ -12,6 +12,11 @@ static int tmp_msgq_processing = 0;
 static int tmp_msgq_restart = 0;
 
 static Eina_Inlist *_edje_msg_trash = NULL;
+static unsigned int _edje_msg_trash_count = 0;
+static Eina_Bool _edje_msg_coalesce = EINA_FALSE;
+
+/* Messages are recycled across main loop iterations, keep at most that many */
+#define EDJE_MESSAGE_TRASH_MAX 256
 
 /*============================================================================*
 *                                   API                                      *
@@ -28,6 +33,7 @@ _edje_msg_trash_pop(void)
    if (!_edje_msg_trash) return NULL;
    em = INLIST_CONTAINER(Edje_Message, _edje_msg_trash, inlist_main);
    _edje_msg_trash = eina_inlist_remove(_edje_msg_trash, &(em->inlist_main));
+   _edje_msg_trash_count--;
    memset(em, 0, sizeof(Edje_Message));
    return em;
 }
@@ -35,7 +41,13 @@ _edje_msg_trash_pop(void)
 static void
 _edje_msg_trash_push(Edje_Message *em)
 {
+   if (_edje_msg_trash_count >= EDJE_MESSAGE_TRASH_MAX)
+     {
+        free(em);
+        return;
+     }
    _edje_msg_trash = eina_inlist_prepend(_edje_msg_trash, &(em->inlist_main));
+   _edje_msg_trash_count++;
 }
 
 static void
@@ -296,7 +308,6 @@ _edje_job(void *data EINA_UNUSED)
    _job = NULL;
    _injob++;
    _edje_message_queue_process();
-   _edje_msg_trash_clear();
    _injob--;
 }
 
@@ -314,6 +325,7 @@ _edje_job_loss_timer(void *data EINA_UNUSED)
 void
 _edje_message_init(void)
 {
+   _edje_msg_coalesce = !!getenv("EDJE_MESSAGE_COALESCE");
 }
 
 void
@@ -355,8 +367,7 @@ _edje_message_new(Edje *ed, Edje_Queue queue, Edje_Message_Type type, int id)
    Edje_Message *em;
 
    em = _edje_msg_trash_pop();
-   if (em) memset(em, 0, sizeof(Edje_Message));
-   else em = calloc(1, sizeof(Edje_Message));
+   if (!em) em = calloc(1, sizeof(Edje_Message));
    if (!em) return NULL;
    em->edje = ed;
    em->edje->message.num++;
@@ -366,6 +377,12 @@ _edje_message_new(Edje *ed, Edje_Queue queue, Edje_Message_Type type, int id)
    return em;
 }
 
+static inline void
+_edje_message_payload_free(Edje_Message *em, void *emsg)
+{
+   if (emsg != (void *)&(em->payload)) free(emsg);
+}
+
 void
 _edje_message_free(Edje_Message *em)
 {
@@ -381,7 +398,7 @@ _edje_message_free(Edje_Message *em)
 
               emsg = (Edje_Message_String *)em->msg;
               free(emsg->str);
-              free(emsg);
+              _edje_message_payload_free(em, emsg);
            }
            break;
 
@@ -390,7 +407,7 @@ _edje_message_free(Edje_Message *em)
               Edje_Message_Int *emsg;
 
               emsg = (Edje_Message_Int *)em->msg;
-              free(emsg);
+              _edje_message_payload_free(em, emsg);
            }
            break;
 
@@ -399,7 +416,7 @@ _edje_message_free(Edje_Message *em)
               Edje_Message_Float *emsg;
 
               emsg = (Edje_Message_Float *)em->msg;
-              free(emsg);
+              _edje_message_payload_free(em, emsg);
            }
            break;
 
@@ -427,7 +444,7 @@ _edje_message_free(Edje_Message *em)
 
               emsg = (Edje_Message_String_Float *)em->msg;
               free(emsg->str);
-              free(emsg);
+              _edje_message_payload_free(em, emsg);
            }
            break;
 
@@ -437,7 +454,7 @@ _edje_message_free(Edje_Message *em)
 
               emsg = (Edje_Message_String_Int *)em->msg;
               free(emsg->str);
-              free(emsg);
+              _edje_message_payload_free(em, emsg);
            }
            break;
 
@@ -469,7 +486,7 @@ _edje_message_free(Edje_Message *em)
               if (emsg->sig) eina_stringshare_del(emsg->sig);
               if (emsg->src) eina_stringshare_del(emsg->src);
               _edje_signal_data_free(emsg->data);
-              free(emsg);
+              _edje_message_payload_free(em, emsg);
            }
            break;
 
@@ -492,6 +509,51 @@ _edje_message_free(Edje_Message *em)
    _edje_msg_trash_push(em);
 }
 
+/* Fold a message into the last one still queued for the same object when
+ * nothing else was queued for it in between: a newer int or float value
+ * replaces the pending one, and the same signal twice in a row is only
+ * emitted once. Apps flooding progress updates then cost one message per
+ * object and iteration. Off unless asked for, as it drops deliveries. */
+static Eina_Bool
+_edje_message_coalesce(Edje *ed, Edje_Queue queue, Edje_Message_Type type, int id, void *emsg, Eina_Bool prop)
+{
+   Edje_Message *last;
+
+   if (!_edje_msg_coalesce) return EINA_FALSE;
+   if (!ed->messages) return EINA_FALSE;
+
+   last = INLIST_CONTAINER(Edje_Message, ed->messages->last, inlist_edje);
+   if (last->in_tmp_msgq) return EINA_FALSE;
+   if ((last->type != type) || (last->queue != queue) ||
+       (last->id != id) || (last->propagated != prop))
+     return EINA_FALSE;
+
+   switch (type)
+     {
+      case EDJE_MESSAGE_INT:
+        ((Edje_Message_Int *)last->msg)->val = ((Edje_Message_Int *)emsg)->val;
+        return EINA_TRUE;
+
+      case EDJE_MESSAGE_FLOAT:
+        ((Edje_Message_Float *)last->msg)->val = ((Edje_Message_Float *)emsg)->val;
+        return EINA_TRUE;
+
+      case EDJE_MESSAGE_SIGNAL:
+      {
+         Edje_Message_Signal *emsg2, *emsg3;
+
+         emsg2 = (Edje_Message_Signal *)emsg;
+         emsg3 = (Edje_Message_Signal *)last->msg;
+         if (emsg2->data || emsg3->data) return EINA_FALSE;
+         return eina_streq(emsg2->sig, emsg3->sig) &&
+           eina_streq(emsg2->src, emsg3->src);
+      }
+
+      default:
+        return EINA_FALSE;
+     }
+}
+
 static void
 _edje_message_propagate_send(Edje *ed, Edje_Queue queue, Edje_Message_Type type, int id, void *emsg, Eina_Bool prop)
 {
@@ -500,6 +562,8 @@ _edje_message_propagate_send(Edje *ed, Edje_Queue queue, Edje_Message_Type type,
    int i;
    unsigned char *msg = NULL;
 
+   if (_edje_message_coalesce(ed, queue, type, id, emsg, prop)) return;
+
    em = _edje_message_new(ed, queue, type, id);
    if (!em) return;
    em->propagated = prop;
@@ -535,7 +599,7 @@ _edje_message_propagate_send(Edje *ed, Edje_Queue queue, Edje_Message_Type type,
          Edje_Message_Signal *emsg2, *emsg3;
 
          emsg2 = (Edje_Message_Signal *)emsg;
-         emsg3 = calloc(1, sizeof(Edje_Message_Signal));
+         emsg3 = &em->payload.sig;
          if (emsg2->sig) emsg3->sig = eina_stringshare_add(emsg2->sig);
          if (emsg2->src) emsg3->src = eina_stringshare_add(emsg2->src);
          if (emsg2->data)
@@ -553,7 +617,7 @@ _edje_message_propagate_send(Edje *ed, Edje_Queue queue, Edje_Message_Type type,
 
          emsg2 = (Edje_Message_String *)emsg;
 
-         emsg3 = malloc(sizeof(Edje_Message_String));
+         emsg3 = &em->payload.str;
          emsg3->str = strdup(emsg2->str);
          msg = (unsigned char *)emsg3;
       }
@@ -564,7 +628,7 @@ _edje_message_propagate_send(Edje *ed, Edje_Queue queue, Edje_Message_Type type,
          Edje_Message_Int *emsg2, *emsg3;
 
          emsg2 = (Edje_Message_Int *)emsg;
-         emsg3 = malloc(sizeof(Edje_Message_Int));
+         emsg3 = &em->payload.i;
          emsg3->val = emsg2->val;
          msg = (unsigned char *)emsg3;
       }
@@ -575,7 +639,7 @@ _edje_message_propagate_send(Edje *ed, Edje_Queue queue, Edje_Message_Type type,
          Edje_Message_Float *emsg2, *emsg3;
 
          emsg2 = (Edje_Message_Float *)emsg;
-         emsg3 = malloc(sizeof(Edje_Message_Float));
+         emsg3 = &em->payload.f;
          emsg3->val = emsg2->val;
          msg = (unsigned char *)emsg3;
       }
@@ -625,7 +689,7 @@ _edje_message_propagate_send(Edje *ed, Edje_Queue queue, Edje_Message_Type type,
          Edje_Message_String_Int *emsg2, *emsg3;
 
          emsg2 = (Edje_Message_String_Int *)emsg;
-         emsg3 = malloc(sizeof(Edje_Message_String_Int));
+         emsg3 = &em->payload.si;
          emsg3->str = strdup(emsg2->str);
          emsg3->val = emsg2->val;
          msg = (unsigned char *)emsg3;
@@ -637,7 +701,7 @@ _edje_message_propagate_send(Edje *ed, Edje_Queue queue, Edje_Message_Type type,
          Edje_Message_String_Float *emsg2, *emsg3;
 
          emsg2 = (Edje_Message_String_Float *)emsg;
-         emsg3 = malloc(sizeof(Edje_Message_String_Float));
+         emsg3 = &em->payload.sf;
          emsg3->str = strdup(emsg2->str);
          emsg3->val = emsg2->val;
          msg = (unsigned char *)emsg3;
@@ -913,23 +977,27 @@ _edje_message_queue_process(void)
         tmp_msgq_processing++;
         while (tmp_msgq)
           {
-             Eina_Inlist *l = tmp_msgq;
              Edje *ed;
 
-             em = INLIST_CONTAINER(Edje_Message, l, inlist_main);
+             em = INLIST_CONTAINER(Edje_Message, tmp_msgq, inlist_main);
              ed = em->edje;
-             tmp_msgq = eina_inlist_remove(tmp_msgq, &(em->inlist_main));
-             em->edje->messages = eina_inlist_remove(em->edje->messages, &(em->inlist_edje));
-             em->edje->message.num--;
-             if (!ed->delete_me)
+             /* handle all messages queued in a row for the same object as
+              * one batch, it is only checked for deletion once at the end */
+             ed->processing_messages++;
+             for (;;)
                {
-                  ed->processing_messages++;
-                  _edje_message_process(em);
+                  tmp_msgq = eina_inlist_remove(tmp_msgq, &(em->inlist_main));
+                  ed->messages = eina_inlist_remove(ed->messages, &(em->inlist_edje));
+                  ed->message.num--;
+                  if (!ed->delete_me)
+                    _edje_message_process(em);
                   _edje_message_free(em);
-                  ed->processing_messages--;
+                  // tmp_msgq may have been changed by a nested process call
+                  if (!tmp_msgq) break;
+                  em = INLIST_CONTAINER(Edje_Message, tmp_msgq, inlist_main);
+                  if (em->edje != ed) break;
                }
-             else
-               _edje_message_free(em);
+             ed->processing_messages--;
              if (ed->processing_messages == 0)
                {
                   if (ed->delete_me) _edje_del(ed);
@@ -1024,6 +1092,18 @@ edje_message_signal_process(void)
    _edje_message_queue_process();
 }
 
+EAPI void
+edje_message_coalesce_set(Eina_Bool coalesce)
+{
+   _edje_msg_coalesce = !!coalesce;
+}
+
+EAPI Eina_Bool
+edje_message_coalesce_get(void)
+{
+   return _edje_msg_coalesce;
+}
+
 EAPI void
 edje_object_message_handler_set(Eo *obj, Edje_Message_Handler_Cb func, void *data)
 {
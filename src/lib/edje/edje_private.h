@@ -1159,6 +1159,13 @@ struct _Edje_Part_Collection
       Edje_Program **table_programs;
       int            table_programs_size;
    } patterns;
+
+   struct {
+      unsigned short *order; /* parts sorted so dependencies come first */
+      unsigned short *dependents; /* parts depending on each part, indexed by dependents_offset */
+      unsigned int   *dependents_offset;
+      Eina_Bool       disabled : 1; /* don't trust the graph, e.g. group is being edited */
+   } calc;
    /* *** *** */
 
    unsigned char    lua_script_only;
@@ -1681,6 +1688,7 @@ struct _Edje
 #ifdef EDJE_CALC_CACHE
    Eina_Bool          text_part_change : 1;
    Eina_Bool          all_part_change : 1;
+   Eina_Bool          dirty_parts : 1; /* only invalidated parts changed */
 #endif
    Eina_Bool          has_size : 1;
 };
@@ -2120,6 +2128,14 @@ struct _Edje_Message
    Eina_Inlist        inlist_edje;
    Edje              *edje;
    unsigned char     *msg;
+   union { // fixed size messages are stored here and msg points to it
+      Edje_Message_Signal       sig;
+      Edje_Message_String       str;
+      Edje_Message_Int          i;
+      Edje_Message_Float        f;
+      Edje_Message_String_Int   si;
+      Edje_Message_String_Float sf;
+   } payload;
    int                id;
    Eina_Bool          in_tmp_msgq :  1;
    Eina_Bool          propagated  :  1;
@@ -2143,11 +2159,13 @@ typedef enum _Edje_Match_Error
 } Edje_Match_Error;
 
 typedef struct _Edje_States     Edje_States;
+typedef struct _Edje_Dfa        Edje_Dfa;
 struct _Edje_Patterns
 {
    const char    **patterns;
 
    Edje_States    *states;
+   Edje_Dfa       *dfa;
 
    int             ref;
    Eina_Bool       delete_me : 1;
@@ -2434,6 +2452,7 @@ Edje_Part_Description_Common *_edje_part_description_find(Edje *ed,
 void  _edje_part_description_apply(Edje *ed, Edje_Real_Part *ep, const char  *d1, double v1, const char *d2, double v2);
 void  _edje_recalc(Edje *ed);
 void  _edje_recalc_do(Edje *ed);
+void  _edje_collection_calc_deps_free(Edje_Part_Collection *ec);
 int   _edje_part_dragable_calc(Edje *ed, Edje_Real_Part *ep, FLOAT_T *x, FLOAT_T *y);
 void  _edje_dragable_pos_set(Edje *ed, Edje_Real_Part *ep, FLOAT_T x, FLOAT_T y);
 
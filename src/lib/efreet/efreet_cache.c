@@ -57,6 +57,8 @@ static Eet_Data_Descriptor *icon_element_edd = NULL;
 static Eet_Data_Descriptor *icon_edd = NULL;
 
 static Eet_File            *icon_cache = NULL;
+static const char          *icon_index = NULL;
+static Eina_Bool            icon_index_checked = EINA_FALSE;
 static Eet_File            *fallback_cache = NULL;
 static Eet_File            *icon_theme_cache = NULL;
 
@@ -285,6 +287,8 @@ _icon_desktop_cache_update_event_add(int event_type)
 
    icon_theme_cache = NULL;
    icon_cache = NULL;
+   icon_index = NULL;
+   icon_index_checked = EINA_FALSE;
    fallback_cache = NULL;
 
    // Send event
@@ -422,6 +426,8 @@ efreet_cache_shutdown(void)
     IF_RELEASE(theme_name);
 
     icon_cache = efreet_cache_close(icon_cache);
+    icon_index = NULL;
+    icon_index_checked = EINA_FALSE;
     icon_theme_cache = efreet_cache_close(icon_theme_cache);
     fallback_cache = efreet_cache_close(fallback_cache);
 
@@ -971,6 +977,322 @@ efreet_desktop_edd(void)
     return desktop_edd;
 }
 
+/*
+ * Icon index
+ *
+ * Next to the eet encoded icons, the icon cache holds a raw uncompressed
+ * blob under EFREET_CACHE_ICON_INDEX: an open addressing hash table over
+ * the icon names, followed by the records and a string table. It is used
+ * in place from the mapped cache file, so looking an icon up is a probe
+ * and a few small allocations for the returned structure instead of an
+ * eet decode, and looking up an icon the theme does not have costs
+ * nothing but the probe.
+ *
+ * All integers are host endian unsigned ints (the cache is per machine),
+ * read with memcpy as eet does not align its entries.
+ *
+ * header:  magic, buckets count (power of 2), records offset,
+ *          strings offset, total size
+ * buckets: record offset relative to the records, ~0 if empty
+ * record:  name hash, name, theme, icons count, then for each icon
+ *          type, normal, min, max, paths count and the paths
+ * strings are offsets relative to the string table, ~0 for NULL
+ */
+#define EFREET_ICON_INDEX_MAGIC 0x58494645 /* EFIX */
+#define EFREET_ICON_INDEX_HEADER_SIZE (5 * sizeof(unsigned int))
+#define EFREET_ICON_INDEX_EMPTY (~0U)
+
+static inline unsigned int
+efreet_icon_index_uint(const char *p)
+{
+    unsigned int v;
+
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static inline void
+efreet_icon_index_uint_append(Eina_Binbuf *buf, unsigned int v)
+{
+    eina_binbuf_append_length(buf, (const unsigned char *)&v, sizeof(v));
+}
+
+static unsigned int
+efreet_icon_index_string_add(Eina_Binbuf *strings, Eina_Hash *offsets, const char *str)
+{
+    uintptr_t off;
+
+    if (!str) return EFREET_ICON_INDEX_EMPTY;
+    /* offsets are stored + 1 so the first string is not NULL */
+    off = (uintptr_t)eina_hash_find(offsets, str);
+    if (off) return off - 1;
+
+    off = eina_binbuf_length_get(strings);
+    eina_binbuf_append_length(strings, (const unsigned char *)str, strlen(str) + 1);
+    eina_hash_add(offsets, str, (void *)(off + 1));
+    return off;
+}
+
+/*
+ * Needs EAPI because of helper binaries
+ */
+EAPI void *
+efreet_icon_cache_index_build(const Eina_Hash *icon_hash, int *size)
+{
+    Eina_Binbuf *records, *strings, *out;
+    Eina_Hash *offsets;
+    Eina_Iterator *it;
+    Eina_Hash_Tuple *tuple;
+    unsigned int *buckets;
+    unsigned int buckets_count = 16, mask, count, i, j;
+    void *ret = NULL;
+
+    if (size) *size = 0;
+    count = eina_hash_population(icon_hash);
+    while (buckets_count < (count * 2)) buckets_count <<= 1;
+    mask = buckets_count - 1;
+
+    buckets = malloc(buckets_count * sizeof(unsigned int));
+    if (!buckets) return NULL;
+    memset(buckets, 0xff, buckets_count * sizeof(unsigned int));
+
+    records = eina_binbuf_new();
+    strings = eina_binbuf_new();
+    offsets = eina_hash_string_superfast_new(NULL);
+
+    it = eina_hash_iterator_tuple_new(icon_hash);
+    EINA_ITERATOR_FOREACH(it, tuple)
+    {
+        const char *name = tuple->key;
+        const Efreet_Cache_Icon *icon = tuple->data;
+        unsigned int hash;
+
+        hash = eina_hash_superfast(name, strlen(name));
+        for (j = hash & mask; buckets[j] != EFREET_ICON_INDEX_EMPTY; j = (j + 1) & mask)
+            ;
+        buckets[j] = eina_binbuf_length_get(records);
+
+        efreet_icon_index_uint_append(records, hash);
+        efreet_icon_index_uint_append(records, efreet_icon_index_string_add(strings, offsets, name));
+        efreet_icon_index_uint_append(records, efreet_icon_index_string_add(strings, offsets, icon->theme));
+        efreet_icon_index_uint_append(records, icon->icons_count);
+        for (i = 0; i < icon->icons_count; ++i)
+        {
+            const Efreet_Cache_Icon_Element *elem = icon->icons[i];
+
+            efreet_icon_index_uint_append(records, elem->type);
+            efreet_icon_index_uint_append(records, elem->normal);
+            efreet_icon_index_uint_append(records, elem->min);
+            efreet_icon_index_uint_append(records, elem->max);
+            efreet_icon_index_uint_append(records, elem->paths_count);
+            for (j = 0; j < elem->paths_count; ++j)
+                efreet_icon_index_uint_append(records, efreet_icon_index_string_add(strings, offsets, elem->paths[j]));
+        }
+    }
+    eina_iterator_free(it);
+
+    out = eina_binbuf_new();
+    efreet_icon_index_uint_append(out, EFREET_ICON_INDEX_MAGIC);
+    efreet_icon_index_uint_append(out, buckets_count);
+    efreet_icon_index_uint_append(out, EFREET_ICON_INDEX_HEADER_SIZE + (buckets_count * sizeof(unsigned int)));
+    efreet_icon_index_uint_append(out, EFREET_ICON_INDEX_HEADER_SIZE + (buckets_count * sizeof(unsigned int)) +
+                                  eina_binbuf_length_get(records));
+    efreet_icon_index_uint_append(out, EFREET_ICON_INDEX_HEADER_SIZE + (buckets_count * sizeof(unsigned int)) +
+                                  eina_binbuf_length_get(records) + eina_binbuf_length_get(strings));
+    eina_binbuf_append_length(out, (const unsigned char *)buckets, buckets_count * sizeof(unsigned int));
+    eina_binbuf_append_buffer(out, records);
+    eina_binbuf_append_buffer(out, strings);
+
+    if (size) *size = eina_binbuf_length_get(out);
+    ret = eina_binbuf_string_steal(out);
+
+    eina_binbuf_free(out);
+    eina_binbuf_free(records);
+    eina_binbuf_free(strings);
+    eina_hash_free(offsets);
+    free(buckets);
+    return ret;
+}
+
+/*
+ * Needs EAPI because of helper binaries
+ */
+EAPI Eina_Bool
+efreet_icon_cache_index_valid(const void *data, int size)
+{
+    const char *index = data;
+    unsigned int buckets_count, records, strings, total;
+
+    if ((!index) || (size < (int)EFREET_ICON_INDEX_HEADER_SIZE)) return EINA_FALSE;
+
+    buckets_count = efreet_icon_index_uint(index + sizeof(unsigned int));
+    records = efreet_icon_index_uint(index + (2 * sizeof(unsigned int)));
+    strings = efreet_icon_index_uint(index + (3 * sizeof(unsigned int)));
+    total = efreet_icon_index_uint(index + (4 * sizeof(unsigned int)));
+    if ((efreet_icon_index_uint(index) != EFREET_ICON_INDEX_MAGIC) ||
+        (total != (unsigned int)size) ||
+        (!buckets_count) || (buckets_count & (buckets_count - 1)) ||
+        (buckets_count > ((total - EFREET_ICON_INDEX_HEADER_SIZE) / sizeof(unsigned int))) ||
+        (records != EFREET_ICON_INDEX_HEADER_SIZE + (buckets_count * sizeof(unsigned int))) ||
+        (strings < records) || (strings > total))
+        return EINA_FALSE;
+    return EINA_TRUE;
+}
+
+static const char *
+efreet_cache_icon_index_get(Eet_File *ef)
+{
+    const char *index;
+    int size = 0;
+
+    index = eet_read_direct(ef, EFREET_CACHE_ICON_INDEX, &size);
+    if (!index) return NULL;
+    if (!efreet_icon_cache_index_valid(index, size))
+    {
+        ERR("Invalid icon index in cache, falling back to eet lookups");
+        return NULL;
+    }
+    return index;
+}
+
+/* The header was checked, but the records and the strings come straight
+ * from the file too: every offset and count is checked against the size of
+ * its table before being used. */
+static inline Eina_Bool
+efreet_icon_index_fits(unsigned int len, unsigned int off, unsigned int count)
+{
+    return (off <= len) && (count <= ((len - off) / sizeof(unsigned int)));
+}
+
+static inline const char *
+efreet_icon_index_string(const char *strings, unsigned int len, unsigned int off)
+{
+    if ((off >= len) || (!memchr(strings + off, 0, len - off))) return NULL;
+    return strings + off;
+}
+
+/*
+ * Needs EAPI because of helper binaries
+ */
+EAPI Efreet_Cache_Icon *
+efreet_icon_cache_index_find(const void *data, const char *icon, Eina_Bool *corrupt)
+{
+    const char *index = data;
+    Efreet_Cache_Icon *cache;
+    const char *records, *strings, *name;
+    unsigned int buckets_count, mask, hash, probe, i, j, off;
+    unsigned int records_len, strings_len, rec, rec_len;
+
+    /* the header was checked by efreet_icon_cache_index_valid() */
+    *corrupt = EINA_FALSE;
+    buckets_count = efreet_icon_index_uint(index + sizeof(unsigned int));
+    off = efreet_icon_index_uint(index + (2 * sizeof(unsigned int)));
+    records = index + off;
+    strings = index + efreet_icon_index_uint(index + (3 * sizeof(unsigned int)));
+    records_len = efreet_icon_index_uint(index + (3 * sizeof(unsigned int))) - off;
+    strings_len = efreet_icon_index_uint(index + (4 * sizeof(unsigned int))) -
+        efreet_icon_index_uint(index + (3 * sizeof(unsigned int)));
+    mask = buckets_count - 1;
+
+    hash = eina_hash_superfast(icon, strlen(icon));
+    rec = EFREET_ICON_INDEX_EMPTY;
+    for (probe = 0, i = hash & mask; probe < buckets_count; probe++, i = (i + 1) & mask)
+    {
+        off = efreet_icon_index_uint(index + EFREET_ICON_INDEX_HEADER_SIZE + (i * sizeof(unsigned int)));
+        if (off == EFREET_ICON_INDEX_EMPTY) return NULL;
+        if (!efreet_icon_index_fits(records_len, off, 4)) goto on_corrupt;
+        if (efreet_icon_index_uint(records + off) != hash) continue;
+
+        name = efreet_icon_index_string(strings, strings_len,
+                                        efreet_icon_index_uint(records + off + sizeof(unsigned int)));
+        if (!name) goto on_corrupt;
+        if (!strcmp(name, icon))
+        {
+            rec = off;
+            break;
+        }
+    }
+    if (rec == EFREET_ICON_INDEX_EMPTY) return NULL;
+
+    /* what is left of the records table from this record on */
+    rec_len = records_len - rec;
+    records += rec;
+
+    cache = NEW(Efreet_Cache_Icon, 1);
+    if (!cache) return NULL;
+    i = 0;
+    off = efreet_icon_index_uint(records + (2 * sizeof(unsigned int)));
+    if (off != EFREET_ICON_INDEX_EMPTY)
+    {
+        cache->theme = efreet_icon_index_string(strings, strings_len, off);
+        if (!cache->theme) goto on_error_corrupt;
+    }
+    cache->icons_count = efreet_icon_index_uint(records + (3 * sizeof(unsigned int)));
+    /* offset in uints from the record start, the probe checked its first 4.
+     * Each icon takes 5 uints at least, do not allocate for what can not be
+     * there. */
+    off = 4;
+    if (cache->icons_count > ((rec_len / sizeof(unsigned int)) - off) / 5)
+        goto on_error_corrupt;
+
+    cache->icons = calloc(cache->icons_count, sizeof(Efreet_Cache_Icon_Element *));
+    if ((!cache->icons) && (cache->icons_count)) goto on_error;
+    for (i = 0; i < cache->icons_count; ++i)
+    {
+        Efreet_Cache_Icon_Element *elem;
+        const char *p;
+
+        if (!efreet_icon_index_fits(rec_len, off * sizeof(unsigned int), 5)) goto on_error_corrupt;
+        p = records + (off * sizeof(unsigned int));
+        off += 5;
+
+        elem = NEW(Efreet_Cache_Icon_Element, 1);
+        if (!elem) goto on_error;
+        cache->icons[i] = elem;
+        elem->type = efreet_icon_index_uint(p);
+        elem->normal = efreet_icon_index_uint(p + sizeof(unsigned int));
+        elem->min = efreet_icon_index_uint(p + (2 * sizeof(unsigned int)));
+        elem->max = efreet_icon_index_uint(p + (3 * sizeof(unsigned int)));
+        elem->paths_count = efreet_icon_index_uint(p + (4 * sizeof(unsigned int)));
+
+        if (!efreet_icon_index_fits(rec_len, off * sizeof(unsigned int), elem->paths_count))
+        {
+            elem->paths_count = 0;
+            goto on_error_corrupt;
+        }
+        p = records + (off * sizeof(unsigned int));
+        off += elem->paths_count;
+
+        elem->paths = calloc(elem->paths_count, sizeof(char *));
+        if ((!elem->paths) && (elem->paths_count)) goto on_error;
+        for (j = 0; j < elem->paths_count; ++j, p += sizeof(unsigned int))
+        {
+            elem->paths[j] = efreet_icon_index_string(strings, strings_len, efreet_icon_index_uint(p));
+            if (!elem->paths[j]) goto on_error_corrupt;
+        }
+    }
+    return cache;
+
+on_corrupt:
+    *corrupt = EINA_TRUE;
+    return NULL;
+
+on_error_corrupt:
+    *corrupt = EINA_TRUE;
+on_error:
+    /* efreet_cache_icon_free() walks the whole array, errors only happen
+     * before it is allocated or with i on a valid entry */
+    if (!cache->icons)
+        cache->icons_count = 0;
+    else
+    {
+        cache->icons_count = i;
+        if (cache->icons[i]) cache->icons_count++;
+    }
+    efreet_cache_icon_free(cache);
+    return NULL;
+}
+
 Efreet_Cache_Icon *
 efreet_cache_icon_find(Efreet_Icon_Theme *theme, const char *icon)
 {
@@ -982,6 +1304,8 @@ efreet_cache_icon_find(Efreet_Icon_Theme *theme, const char *icon)
         INF("theme_name change from '%s' to '%s'", theme_name, theme->name.internal);
         IF_RELEASE(theme_name);
         icon_cache = efreet_cache_close(icon_cache);
+        icon_index = NULL;
+        icon_index_checked = EINA_FALSE;
         eina_hash_free(icons);
         icons = eina_hash_string_superfast_new(EINA_FREE_CB(efreet_cache_icon_free));
     }
@@ -994,7 +1318,24 @@ efreet_cache_icon_find(Efreet_Icon_Theme *theme, const char *icon)
     if (cache == NON_EXISTING) return NULL;
     if (cache) return cache;
 
-    cache = eet_data_read(icon_cache, efreet_icon_edd(), icon);
+    if (!icon_index_checked)
+    {
+        icon_index = efreet_cache_icon_index_get(icon_cache);
+        icon_index_checked = EINA_TRUE;
+    }
+    if (icon_index)
+    {
+        Eina_Bool corrupt;
+
+        cache = efreet_icon_cache_index_find(icon_index, icon, &corrupt);
+        if (corrupt)
+        {
+            ERR("Corrupted icon index in cache, falling back to eet lookups");
+            icon_index = NULL;
+        }
+    }
+    if (!icon_index)
+        cache = eet_data_read(icon_cache, efreet_icon_edd(), icon);
     if (cache)
         eina_hash_add(icons, icon, cache);
     else
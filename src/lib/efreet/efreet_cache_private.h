@@ -7,10 +7,11 @@
 #define EFREET_DESKTOP_UTILS_CACHE_MINOR 0
 
 #define EFREET_ICON_CACHE_MAJOR 1
-#define EFREET_ICON_CACHE_MINOR 0
+#define EFREET_ICON_CACHE_MINOR 1
 
 #define EFREET_CACHE_VERSION "__efreet//version"
 #define EFREET_CACHE_ICON_FALLBACK "__efreet_fallback"
+#define EFREET_CACHE_ICON_INDEX "__efreet//icon_index"
 
 #ifdef EAPI
 # undef EAPI
@@ -61,6 +62,10 @@ EAPI Eet_Data_Descriptor *efreet_icon_theme_edd(Eina_Bool cache);
 EAPI Eet_Data_Descriptor *efreet_icon_edd(void);
 EAPI Eet_Data_Descriptor *efreet_icon_fallback_edd(void);
 
+EAPI void *efreet_icon_cache_index_build(const Eina_Hash *icons, int *size);
+EAPI Eina_Bool efreet_icon_cache_index_valid(const void *index, int size);
+EAPI Efreet_Cache_Icon *efreet_icon_cache_index_find(const void *index, const char *icon, Eina_Bool *corrupt);
+
 struct _Efreet_Cache_Check
 {
    unsigned long long uid;
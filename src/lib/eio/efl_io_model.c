@@ -58,18 +58,38 @@ _eio_file_error_cb(void *data, Eio_File *handler, int error)
 }
 
 
+static inline unsigned int
+_files_count(const Efl_Io_Model_Data *pd)
+{
+   return pd->files ? eina_inarray_count(pd->files) : 0;
+}
+
+static inline Efl_Io_Model_Info *
+_files_nth(const Efl_Io_Model_Data *pd, unsigned int i)
+{
+   return *(Efl_Io_Model_Info **) eina_inarray_nth(pd->files, i);
+}
+
 static Eina_Bool
-_already_added(Efl_Io_Model_Data *pd, const char *path)
+_already_added(Efl_Io_Model_Data *pd, Eina_Stringshare *path)
 {
-   Efl_Io_Model_Info *mi;
-   Eina_List *node;
+   if (!pd->files_hash) return EINA_FALSE;
+   return !!eina_hash_find(pd->files_hash, path);
+}
 
-   EINA_LIST_FOREACH(pd->files, node, mi)
+static unsigned int
+_files_append(Efl_Io_Model_Data *pd, Efl_Io_Model_Info *mi)
+{
+   if (!pd->files)
      {
-        if (eina_streq(mi->path, path))
-          return EINA_TRUE;
+        pd->files = eina_inarray_new(sizeof (Efl_Io_Model_Info *), 0);
+        pd->files_hash = eina_hash_stringshared_new(NULL);
      }
-   return EINA_FALSE;
+
+   mi->index = eina_inarray_count(pd->files);
+   mi->serial = ++pd->files_serial;
+   eina_hash_add(pd->files_hash, mi->path, mi);
+   return eina_inarray_push(pd->files, &mi);
 }
 
 /**
@@ -84,7 +104,6 @@ _efl_model_evt_added_ecore_cb(void *data, int type, void *event)
    Efl_Io_Model_Data *pd;
    Efl_Model_Children_Event cevt = {0};
    Efl_Io_Model_Info *mi;
-   Eina_List *l;
    Eina_Stringshare *spath = NULL;
    char *path = NULL;
 
@@ -96,21 +115,14 @@ _efl_model_evt_added_ecore_cb(void *data, int type, void *event)
 
    if (ev->monitor != pd->monitor) return EINA_TRUE;
 
-   if (_already_added(pd, ev->filename))
-     return EINA_TRUE;
+   spath = eina_stringshare_add(ev->filename);
+   if (_already_added(pd, spath))
+     goto end;
 
    path = ecore_file_dir_get(ev->filename);
    if (!eina_streq(pd->path, path))
      goto end;
 
-   spath = eina_stringshare_add(ev->filename);
-
-   EINA_LIST_FOREACH(pd->files, l, mi)
-     {
-        if (mi->path == spath)
-          goto end;
-     }
-
    mi = calloc(1, sizeof (Efl_Io_Model_Info));
    if (!mi) goto end;
 
@@ -141,8 +153,7 @@ _efl_model_evt_added_ecore_cb(void *data, int type, void *event)
           }
      }
 
-   cevt.index = eina_list_count(pd->files);
-   pd->files = eina_list_append(pd->files, mi);
+   cevt.index = _files_append(pd, mi);
 
    // Notify of the new child being added
    efl_event_callback_call(obj, EFL_MODEL_EVENT_CHILD_ADDED, &cevt);
@@ -159,21 +170,20 @@ static void
 _model_child_remove(Efl_Io_Model *obj, Efl_Io_Model_Data *pd, Eina_Stringshare *path)
 {
    Efl_Io_Model_Info *mi;
-   Eina_List *l;
    Efl_Model_Children_Event cevt = { 0 };
-   unsigned int i = 0;
+   unsigned int i, count;
 
-   // FIXME: Linear search is pretty slow
-   EINA_LIST_FOREACH(pd->files, l, mi)
+   if (!pd->files_hash) return;
+   mi = eina_hash_find(pd->files_hash, path);
+   if (!mi) return;
+
+   i = mi->index;
+   if (i >= _files_count(pd) || _files_nth(pd, i) != mi)
      {
-        if (mi->path == path)
-          break ;
-        ++i;
+        ERR("Child '%s' is not at its recorded index %u.", path, i);
+        return;
      }
 
-   if (i >= eina_list_count(pd->files))
-     return;
-
    cevt.index = i;
    cevt.child = mi->object;
 
@@ -181,7 +191,16 @@ _model_child_remove(Efl_Io_Model *obj, Efl_Io_Model_Data *pd, Eina_Stringshare *
    efl_event_callback_call(obj, EFL_MODEL_EVENT_CHILDREN_COUNT_CHANGED, NULL);
 
    // Remove the entry from the files list
-   pd->files = eina_list_remove_list(pd->files, l);
+   eina_hash_del_by_key(pd->files_hash, path);
+   eina_inarray_remove_at(pd->files, i);
+   for (count = _files_count(pd); i < count; i++)
+     _files_nth(pd, i)->index = i;
+
+   // The file is gone, whatever was stat'ed for it is stale now and
+   // any batch still in flight for it must not land on a new entry.
+   free(mi->st);
+   mi->st = NULL;
+   mi->stat_batched = EINA_FALSE;
 
    // This will only trigger the data destruction if no object is referencing them.
    _efl_io_model_info_free(mi, EINA_FALSE);
@@ -210,6 +229,43 @@ _efl_model_evt_deleted_ecore_cb(void *data, int type, void *event)
    return EINA_TRUE;
 }
 
+static Eina_Bool
+_efl_model_evt_modified_ecore_cb(void *data, int type, void *event)
+{
+   Eio_Monitor_Event *ev = event;
+   Efl_Io_Model *obj = data;
+   Efl_Io_Model_Data *pd;
+   Efl_Io_Model_Info *mi;
+   Eina_Stringshare *spath = NULL;
+
+   pd = efl_data_scope_get(obj, EFL_IO_MODEL_CLASS);
+   EINA_SAFETY_ON_FALSE_RETURN_VAL(pd, EINA_TRUE);
+
+   if (type != EIO_MONITOR_DIRECTORY_MODIFIED && type != EIO_MONITOR_FILE_MODIFIED)
+     return EINA_TRUE;
+
+   if (ev->monitor != pd->monitor) return EINA_TRUE;
+   if (!pd->files_hash) return EINA_TRUE;
+
+   spath = eina_stringshare_add(ev->filename);
+   mi = eina_hash_find(pd->files_hash, spath);
+   if (mi)
+     {
+        // The next object created on this entry must stat it again, and
+        // a batch still in flight may have seen it before the change.
+        free(mi->st);
+        mi->st = NULL;
+        if (mi->stat_batched)
+          {
+             mi->serial = ++pd->files_serial;
+             mi->stat_batched = EINA_FALSE;
+          }
+     }
+   eina_stringshare_del(spath);
+
+   return EINA_TRUE;
+}
+
 /**
  *  Callbacks
  *  Child Del
@@ -269,6 +325,7 @@ _efl_io_model_info_free(Efl_Io_Model_Info *info, Eina_Bool model)
      return ;
 
    eina_stringshare_replace(&info->path, NULL);
+   free(info->st);
    free(info);
 }
 
@@ -327,23 +384,30 @@ _efl_io_model_info_build(const Efl_Io_Model *model, Efl_Io_Model_Data *pd)
    pd->info->parent_ref = EINA_TRUE;
 }
 
-static void
-_eio_build_st_done(void *data, Eio_File *handler EINA_UNUSED, const Eina_Stat *stat)
+static Eina_Stat *
+_efl_io_model_stat_dup(const Eina_Stat *st)
 {
-   Efl_Io_Model *model = data;
-   Efl_Io_Model_Data *pd = efl_data_scope_get(model, EFL_IO_MODEL_CLASS);
+   Eina_Stat *r;
 
-   if (!pd) return ;
-   pd->request.stat = NULL;
+   if (!st) return NULL;
 
-   pd->st = malloc(sizeof (Eina_Stat));
-   if (!pd->st) return ;
+   r = malloc(sizeof (Eina_Stat));
+   if (r) memcpy(r, st, sizeof (Eina_Stat));
+   return r;
+}
 
-   memcpy(pd->st, stat, sizeof (Eina_Stat));
+static void
+_eio_build_st_apply(Efl_Io_Model *model, Efl_Io_Model_Data *pd, const Eina_Stat *stat)
+{
+   pd->st = _efl_io_model_stat_dup(stat);
+   if (!pd->st) return ;
 
    if (!pd->info) _efl_io_model_info_build(model, pd);
    if (pd->info->type == EINA_FILE_UNKNOWN)
      pd->info->type = _efl_io_model_info_type_get(NULL, stat);
+   // Remember it for the next object created on this entry
+   if (!pd->info->st)
+     pd->info->st = _efl_io_model_stat_dup(stat);
 
    efl_model_properties_changed(model, "mtime", "atime", "ctime", "is_dir", "is_lnk", "size", "stat");
 
@@ -355,6 +419,18 @@ _eio_build_st_done(void *data, Eio_File *handler EINA_UNUSED, const Eina_Stat *s
         // And start listing its child
         efl_model_children_count_get(model);
      }
+}
+
+static void
+_eio_build_st_done(void *data, Eio_File *handler EINA_UNUSED, const Eina_Stat *stat)
+{
+   Efl_Io_Model *model = data;
+   Efl_Io_Model_Data *pd = efl_data_scope_get(model, EFL_IO_MODEL_CLASS);
+
+   if (!pd) return ;
+   pd->request.stat = NULL;
+
+   _eio_build_st_apply(model, pd, stat);
 
    efl_unref(model);
 }
@@ -372,6 +448,14 @@ _eio_build_st_done_clobber(void *data, Eio_File *handler, const Eina_Stat *stat)
    efl_unref(model); // From the async thread early ref
 }
 
+static void
+_eio_build_st_fail(Efl_Io_Model *model, Efl_Io_Model_Data *pd, int error)
+{
+   pd->error = error;
+
+   efl_model_properties_changed(model, "direct_info", "mtime", "atime", "ctime", "is_dir", "is_lnk", "size", "stat");
+}
+
 static void
 _eio_build_st_error(void *data, Eio_File *handler EINA_UNUSED, int error)
 {
@@ -379,9 +463,7 @@ _eio_build_st_error(void *data, Eio_File *handler EINA_UNUSED, int error)
    Efl_Io_Model_Data *pd = efl_data_scope_get(model, EFL_IO_MODEL_CLASS);
 
    pd->request.stat = NULL;
-   pd->error = error;
-
-   efl_model_properties_changed(model, "direct_info", "mtime", "atime", "ctime", "is_dir", "is_lnk", "size", "stat");
+   _eio_build_st_fail(model, pd, error);
 
    efl_unref(model);
 }
@@ -402,6 +484,8 @@ _eio_build_st(const Efl_Io_Model *model, Efl_Io_Model_Data *pd)
    if (pd->st) return ;
    if (pd->request.stat) return ;
    if (pd->error) return ;
+   // Our parent is already taking care of it
+   if (pd->info && pd->info->stat_batched) return ;
 
    pd->request.stat = eio_file_direct_stat(pd->path,
                                            _eio_build_st_done,
@@ -792,21 +876,24 @@ _efl_io_model_children_list(void *data, Eina_Array *entries)
    EINA_ARRAY_ITER_NEXT(entries, i, info, iterator)
      {
         Efl_Io_Model_Info *mi;
+        Eina_Stringshare *path;
 
         if (!_monitor_has_context(pd, info->path)) continue;
-        if (_already_added(pd, info->path)) continue;
+
+        path = eina_stringshare_add(info->path);
+        if (_already_added(pd, path)) goto skip;
 
         if (pd->filter.cb)
           {
              if (!pd->filter.cb(pd->filter.data, obj, info))
-               continue ;
+               goto skip;
           }
 
         mi = calloc(1, sizeof (Efl_Io_Model_Info));
-        if (!mi) continue ;
+        if (!mi) goto skip;
 
         mi->path_length = info->path_length;
-        mi->path = eina_stringshare_add(info->path);
+        mi->path = path;
 
         mi->name_start = info->name_start;
         mi->name_length = info->name_length;
@@ -814,12 +901,14 @@ _efl_io_model_children_list(void *data, Eina_Array *entries)
         mi->parent_ref = EINA_FALSE;
         mi->child_ref = EINA_TRUE;
 
-        cevt.index = eina_list_count(pd->files);
+        cevt.index = _files_append(pd, mi);
         cevt.child = NULL;
 
-        pd->files = eina_list_append(pd->files, mi);
-
         efl_event_callback_call(obj, EFL_MODEL_EVENT_CHILD_ADDED, &cevt);
+        continue;
+
+     skip:
+        eina_stringshare_del(path);
      }
 
    efl_event_callback_call(obj, EFL_MODEL_EVENT_CHILDREN_COUNT_CHANGED, NULL);
@@ -875,7 +964,7 @@ _efl_io_model_efl_model_children_count_get(const Eo *obj, Efl_Io_Model_Data *pd)
                                               .data = pd);
      }
 
-   return eina_list_count(pd->files);
+   return _files_count(pd);
 }
 
 static void
@@ -894,6 +983,10 @@ _efl_io_model_efl_model_monitor_add(const Eo *obj, Efl_Io_Model_Data *priv)
         for (i = 0; priv->mon.mon_event_child_del[i] != EIO_MONITOR_ERROR ; ++i)
           priv->mon.ecore_child_del_handler[i] =
             ecore_event_handler_add(priv->mon.mon_event_child_del[i], _efl_model_evt_deleted_ecore_cb, obj);
+
+        for (i = 0; priv->mon.mon_event_child_mod[i] != EIO_MONITOR_ERROR ; ++i)
+          priv->mon.ecore_child_mod_handler[i] =
+            ecore_event_handler_add(priv->mon.mon_event_child_mod[i], _efl_model_evt_modified_ecore_cb, obj);
      }
 }
 
@@ -909,6 +1002,9 @@ _efl_io_model_efl_model_monitor_del(Efl_Io_Model_Data *priv)
         for (i = 0; priv->mon.mon_event_child_del[i] != EIO_MONITOR_ERROR ; ++i)
            ecore_event_handler_del(priv->mon.ecore_child_del_handler[i]);
 
+        for (i = 0; priv->mon.mon_event_child_mod[i] != EIO_MONITOR_ERROR ; ++i)
+           ecore_event_handler_del(priv->mon.ecore_child_mod_handler[i]);
+
         eio_monitor_del(priv->monitor);
         priv->monitor = NULL;
      }
@@ -981,6 +1077,161 @@ _efl_io_model_efl_model_child_del(Eo *obj EINA_UNUSED,
      }
 }
 
+/**
+ * Children are stat'ed by chunk on the thread pool as soon as a view asks
+ * for them, instead of one thread per child on first property access.
+ */
+typedef struct _Efl_Io_Model_Stat_Item Efl_Io_Model_Stat_Item;
+typedef struct _Efl_Io_Model_Stat_Batch Efl_Io_Model_Stat_Batch;
+
+struct _Efl_Io_Model_Stat_Item
+{
+   Eina_Stringshare *path;
+   unsigned int serial;
+   Eina_Stat st;
+   int error;
+};
+
+struct _Efl_Io_Model_Stat_Batch
+{
+   Efl_Io_Model *model;
+   unsigned int count;
+   Efl_Io_Model_Stat_Item items[];
+};
+
+#define EFL_IO_MODEL_STAT_BATCH 64
+
+static void
+_efl_io_model_stat_batch_heavy(void *data, Ecore_Thread *thread)
+{
+   Efl_Io_Model_Stat_Batch *batch = data;
+   unsigned int i;
+
+   for (i = 0; i < batch->count; i++)
+     {
+        Efl_Io_Model_Stat_Item *item = &batch->items[i];
+        _eio_stat_t buf;
+
+        if (ecore_thread_check(thread)) break;
+
+        if (_eio_stat(item->path, &buf) != 0)
+          {
+             item->error = errno;
+             continue;
+          }
+
+        _eio_file_struct_2_eina(&item->st, &buf);
+        item->error = 0;
+     }
+}
+
+static void
+_efl_io_model_stat_batch_end(void *data, Ecore_Thread *thread)
+{
+   Efl_Io_Model_Stat_Batch *batch = data;
+   Efl_Io_Model_Data *pd;
+   Eina_Bool alive;
+   unsigned int i;
+
+   pd = efl_data_scope_get(batch->model, MY_CLASS);
+   pd->request.stat_batch = eina_list_remove(pd->request.stat_batch, thread);
+   alive = !efl_invalidated_get(batch->model) && !efl_invalidating_get(batch->model);
+
+   for (i = 0; i < batch->count; i++)
+     {
+        Efl_Io_Model_Stat_Item *item = &batch->items[i];
+        Efl_Io_Model_Info *info = NULL;
+
+        if (pd->files_hash)
+          info = eina_hash_find(pd->files_hash, item->path);
+        // The file may have been deleted and recreated since
+        if (!info || info->serial != item->serial) goto next;
+
+        info->stat_batched = EINA_FALSE;
+        if (item->error == ECANCELED) goto next;
+
+        if (!item->error && !info->st)
+          {
+             info->st = _efl_io_model_stat_dup(&item->st);
+             // Entries coming from the monitor have no type yet, without
+             // it they could not be listed even once stat'ed.
+             if (info->type == EINA_FILE_UNKNOWN)
+               info->type = _efl_io_model_info_type_get(NULL, &item->st);
+          }
+
+        if (alive && info->object)
+          {
+             Efl_Io_Model_Data *child_pd;
+
+             child_pd = efl_data_scope_get(info->object, MY_CLASS);
+             if (child_pd->st || child_pd->request.stat) goto next;
+
+             if (item->error)
+               _eio_build_st_fail(info->object, child_pd, item->error);
+             else
+               _eio_build_st_apply(info->object, child_pd, &item->st);
+          }
+
+     next:
+        eina_stringshare_del(item->path);
+     }
+
+   efl_unref(batch->model);
+   free(batch);
+}
+
+static void
+_efl_io_model_stat_batch_run(Eo *obj, Efl_Io_Model_Data *pd, Efl_Io_Model_Stat_Batch *batch)
+{
+   Ecore_Thread *thread;
+
+   batch->model = efl_ref(obj);
+
+   // On failure, ecore_thread_run already called the cancel callback
+   thread = ecore_thread_run(_efl_io_model_stat_batch_heavy,
+                             _efl_io_model_stat_batch_end,
+                             _efl_io_model_stat_batch_end,
+                             batch);
+   if (thread)
+     pd->request.stat_batch = eina_list_append(pd->request.stat_batch, thread);
+}
+
+static void
+_efl_io_model_stat_batch(Eo *obj, Efl_Io_Model_Data *pd, unsigned int start, unsigned int end)
+{
+   Efl_Io_Model_Stat_Batch *batch = NULL;
+   unsigned int i;
+
+   for (i = start; i < end; i++)
+     {
+        Efl_Io_Model_Info *info = _files_nth(pd, i);
+
+        if (info->st || info->stat_batched) continue;
+
+        if (!batch)
+          {
+             batch = malloc(sizeof (Efl_Io_Model_Stat_Batch) +
+                            EFL_IO_MODEL_STAT_BATCH * sizeof (Efl_Io_Model_Stat_Item));
+             if (!batch) return ;
+             batch->count = 0;
+          }
+
+        info->stat_batched = EINA_TRUE;
+        batch->items[batch->count].path = eina_stringshare_ref(info->path);
+        batch->items[batch->count].serial = info->serial;
+        batch->items[batch->count].error = ECANCELED;
+        batch->count++;
+
+        if (batch->count == EFL_IO_MODEL_STAT_BATCH)
+          {
+             _efl_io_model_stat_batch_run(obj, pd, batch);
+             batch = NULL;
+          }
+     }
+
+   if (batch) _efl_io_model_stat_batch_run(obj, pd, batch);
+}
+
 /**
  * Children Slice Get
  */
@@ -990,7 +1241,7 @@ _efl_io_model_efl_model_children_slice_get(Eo *obj, Efl_Io_Model_Data *pd,
 {
    Eina_Future_Scheduler *scheduler = NULL;
    Eina_Value array = EINA_VALUE_EMPTY;
-   Eina_List *ls = NULL;
+   unsigned int i, end;
 
    // If called on an invalidated model, we won't have a scheduler
    scheduler = efl_loop_future_scheduler_get(obj);
@@ -998,21 +1249,20 @@ _efl_io_model_efl_model_children_slice_get(Eo *obj, Efl_Io_Model_Data *pd,
 
    if (count == 0)
      {
-        count = eina_list_count(pd->files);
+        count = _files_count(pd);
         start = 0;
      }
 
    // Children must have been listed first
-   if (count == 0 || (start + count > eina_list_count(pd->files)))
+   if (count == 0 || (start + count > _files_count(pd)))
      return eina_future_rejected(scheduler, EFL_MODEL_ERROR_INCORRECT_VALUE);
 
    eina_value_array_setup(&array, EINA_VALUE_TYPE_OBJECT, count % 8);
 
-   ls = eina_list_nth_list(pd->files, start);
-
-   while (count > 0)
+   end = start + count;
+   for (i = start; i < end; i++)
      {
-        Efl_Io_Model_Info *info = eina_list_data_get(ls);
+        Efl_Io_Model_Info *info = _files_nth(pd, i);
         Efl_Io_Model_Data *child_data = NULL;
 
         info->parent_ref = EINA_TRUE;
@@ -1024,7 +1274,7 @@ _efl_io_model_efl_model_children_slice_get(Eo *obj, Efl_Io_Model_Data *pd,
                                      child_data = efl_data_scope_get(efl_added, EFL_IO_MODEL_CLASS),
                                      child_data->info = info,
                                      child_data->path = eina_stringshare_ref(info->path),
-                                     child_data->parent = ls,
+                                     child_data->st = _efl_io_model_stat_dup(info->st),
                                      // NOTE: We are assuming here that the parent model will outlive all its children
                                      child_data->filter.cb = pd->filter.cb,
                                      child_data->filter.data = pd->filter.data);
@@ -1034,11 +1284,10 @@ _efl_io_model_efl_model_children_slice_get(Eo *obj, Efl_Io_Model_Data *pd,
 
         efl_wref_add(info->object, &info->object);
         efl_unref(info->object);
-
-        count--;
-        ls = eina_list_next(ls);
      }
 
+   _efl_io_model_stat_batch(obj, pd, start, end);
+
    return eina_future_resolved(scheduler, array);
 }
 
@@ -1066,6 +1315,9 @@ _efl_io_model_efl_object_finalize(Eo *obj, Efl_Io_Model_Data *pd)
    pd->mon.mon_event_child_del[0] = EIO_MONITOR_DIRECTORY_DELETED;
    pd->mon.mon_event_child_del[1] = EIO_MONITOR_FILE_DELETED;
    pd->mon.mon_event_child_del[2] = EIO_MONITOR_ERROR;
+   pd->mon.mon_event_child_mod[0] = EIO_MONITOR_DIRECTORY_MODIFIED;
+   pd->mon.mon_event_child_mod[1] = EIO_MONITOR_FILE_MODIFIED;
+   pd->mon.mon_event_child_mod[2] = EIO_MONITOR_ERROR;
 
    return obj;
 }
@@ -1095,8 +1347,20 @@ _efl_io_model_efl_object_destructor(Eo *obj , Efl_Io_Model_Data *priv)
    _efl_io_model_info_free(priv->info, EINA_TRUE);
    priv->info = NULL;
 
-   EINA_LIST_FREE(priv->files, info)
-     _efl_io_model_info_free(info, EINA_FALSE);
+   if (priv->files)
+     {
+        unsigned int i;
+
+        for (i = 0; i < eina_inarray_count(priv->files); i++)
+          {
+             info = _files_nth(priv, i);
+             _efl_io_model_info_free(info, EINA_FALSE);
+          }
+        eina_inarray_free(priv->files);
+        eina_hash_free(priv->files_hash);
+        priv->files = NULL;
+        priv->files_hash = NULL;
+     }
 
    eina_stringshare_replace(&priv->path, NULL);
 
@@ -1144,6 +1408,14 @@ _efl_io_model_efl_object_invalidate(Eo *obj , Efl_Io_Model_Data *priv)
              ecore_thread_wait(priv->request.stat->thread, 0.1);
           }
      }
+   if (priv->request.stat_batch)
+     {
+        Ecore_Thread *thread;
+        Eina_List *l, *ll;
+
+        EINA_LIST_FOREACH_SAFE(priv->request.stat_batch, l, ll, thread)
+          ecore_thread_cancel(thread);
+     }
 }
 
 #include "efl_io_model.eo.c"
@@ -11,8 +11,10 @@ struct _Efl_Io_Model_Monitor_Data
 {
    Ecore_Event_Handler *ecore_child_add_handler[3];
    Ecore_Event_Handler *ecore_child_del_handler[3];
+   Ecore_Event_Handler *ecore_child_mod_handler[3];
    int mon_event_child_add[3]; /**< plus EIO_MONITOR_ERROR */
    int mon_event_child_del[3]; /**< plus EIO_MONITOR_ERROR */
+   int mon_event_child_mod[3]; /**< plus EIO_MONITOR_ERROR */
 };
 
 // FIXME: Would be more efficient to introduce an Eina_Path that assemble
@@ -22,6 +24,7 @@ struct _Efl_Io_Model_Info
 {
    Eina_Stringshare *path;
    Eo *object;
+   Eina_Stat *st; // Filled by the parent batched stat, kept when the object goes away
 
    size_t path_length;
    size_t name_length;
@@ -29,8 +32,12 @@ struct _Efl_Io_Model_Info
 
    Eina_File_Type type;
 
+   unsigned int index; // Position in the parent files array
+   unsigned int serial; // Tells apart entries recreated under the same path
+
    Eina_Bool parent_ref : 1;
    Eina_Bool child_ref : 1;
+   Eina_Bool stat_batched : 1; // A batched stat is in flight for it
 };
 
 struct _Efl_Io_Model_Data
@@ -47,6 +54,7 @@ struct _Efl_Io_Model_Data
       Eio_File *move;
       Eio_File *del;
       Eina_Future *mime;
+      Eina_List *stat_batch; // Ecore_Thread stating children by chunk
    } request;
 
    struct {
@@ -58,9 +66,9 @@ struct _Efl_Io_Model_Data
    Efl_Io_Model_Monitor_Data mon;
 
    Eio_Monitor *monitor; // Notification stuff
-   // FIXME: would be interesting to figure a more efficient structure for holding files
-   Eina_List *parent;
-   Eina_List *files; // Efl_Io_Model_Info
+   Eina_Inarray *files; // Efl_Io_Model_Info *, in children index order
+   Eina_Hash *files_hash; // Efl_Io_Model_Info indexed by path stringshare
+   unsigned int files_serial;
 
    Eina_Error error;
 
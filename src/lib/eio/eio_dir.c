@@ -62,38 +62,109 @@ _eio_dir_recursive_progress(Eio_Dir_Copy *copy, Eio_File *handler, const Eina_Fi
    return EINA_TRUE;
 }
 
-static Eina_Bool
-_eio_file_recursiv_ls(Ecore_Thread *thread,
-                      Eio_File *common,
-                      Eio_Filter_Direct_Cb filter_cb,
-		      Eina_Iterator *(*Eina_File_Ls)(const char *target),
-                      void *data,
-                      const char *target)
+/* Directories found during a recursive walk are listed and stat'ed ahead
+ * of time by a few helper threads, while the walking thread still calls
+ * the filter in the exact order a sequential walk would.
+ */
+typedef struct _Eio_Dir_Entry Eio_Dir_Entry;
+typedef struct _Eio_Dir_Job Eio_Dir_Job;
+typedef struct _Eio_Dir_Walker Eio_Dir_Walker;
+
+typedef enum {
+  EIO_DIR_JOB_WAITING,
+  EIO_DIR_JOB_RUNNING,
+  EIO_DIR_JOB_DONE
+} Eio_Dir_Job_State;
+
+struct _Eio_Dir_Entry
+{
+   unsigned int offset;
+   unsigned int path_length;
+   unsigned int name_start;
+   Eina_File_Type type;
+};
+
+struct _Eio_Dir_Job
+{
+   const char *path;
+
+   Eina_Inarray entries;
+   Eina_Binbuf *names;
+
+   int error;
+   Eio_Dir_Job_State state;
+};
+
+struct _Eio_Dir_Walker
+{
+   Eina_Iterator *(*ls)(const char *target);
+
+   Eina_Lock lock;
+   Eina_Condition cond;
+
+   Eina_List *todo;
+   unsigned int ready;
+
+   Eina_Thread workers[EIO_DIR_WORKERS_MAX];
+   unsigned int workers_count;
+
+   /* handed to the filter, subdirectories are only walked once a
+    * directory is done so one is enough */
+   Eina_File_Direct_Info info;
+
+   Eina_Bool workers_tried : 1;
+   Eina_Bool stop : 1;
+};
+
+static Eio_Dir_Job *
+_eio_dir_job_new(const char *path)
+{
+   Eio_Dir_Job *job;
+
+   job = calloc(1, sizeof (Eio_Dir_Job));
+   if (!job) return NULL;
+
+   job->path = eina_stringshare_add(path);
+   eina_inarray_step_set(&job->entries, sizeof (Eina_Inarray),
+                         sizeof (Eio_Dir_Entry), 64);
+   return job;
+}
+
+static void
+_eio_dir_job_free(Eio_Dir_Job *job)
+{
+   eina_stringshare_del(job->path);
+   eina_inarray_flush(&job->entries);
+   if (job->names) eina_binbuf_free(job->names);
+   free(job);
+}
+
+/* Run by any thread, must not touch anything but the job itself */
+static void
+_eio_dir_job_run(Eio_Dir_Walker *walker, Eio_Dir_Job *job)
 {
    Eina_File_Direct_Info *info;
-   Eina_Iterator *it = NULL;
-   Eina_List *dirs = NULL;
-   const char *dir;
+   Eina_Iterator *it;
 
-   it = Eina_File_Ls(target);
+   it = walker->ls(job->path);
    if (!it)
      {
-        eio_file_thread_error(common, thread);
-        return EINA_FALSE;
+        job->error = errno;
+        return;
      }
 
-   eio_file_container_set(common, eina_iterator_container_get(it));
+   job->names = eina_binbuf_new();
 
    EINA_ITERATOR_FOREACH(it, info)
      {
-        Eina_Bool filter = EINA_TRUE;
+        Eio_Dir_Entry entry;
         _eio_stat_t buffer;
 
         switch (info->type)
           {
            case EINA_FILE_DIR:
               if (_eio_lstat(info->path, &buffer) != 0)
-		continue;
+                continue;
 
 #ifndef _WIN32
               if (S_ISLNK(buffer.st_mode))
@@ -103,9 +174,234 @@ _eio_file_recursiv_ls(Ecore_Thread *thread,
               break;
           }
 
+        entry.offset = eina_binbuf_length_get(job->names);
+        entry.path_length = info->path_length;
+        entry.name_start = info->name_start;
+        entry.type = info->type;
+
+        eina_binbuf_append_length(job->names, (const unsigned char *) info->path,
+                                  info->path_length + 1);
+        eina_inarray_push(&job->entries, &entry);
+     }
+
+   eina_iterator_free(it);
+}
+
+static void *
+_eio_dir_worker(void *data, Eina_Thread t EINA_UNUSED)
+{
+   Eio_Dir_Walker *walker = data;
+   Eio_Dir_Job *job;
+
+   eina_lock_take(&walker->lock);
+   for (;;)
+     {
+        /* don't run too far ahead of the walking thread */
+        while (!walker->stop &&
+               (!walker->todo || walker->ready >= EIO_DIR_READY_MAX))
+          eina_condition_wait(&walker->cond);
+        if (walker->stop) break;
+
+        job = eina_list_data_get(walker->todo);
+        walker->todo = eina_list_remove_list(walker->todo, walker->todo);
+        job->state = EIO_DIR_JOB_RUNNING;
+        eina_lock_release(&walker->lock);
+
+        _eio_dir_job_run(walker, job);
+
+        eina_lock_take(&walker->lock);
+        job->state = EIO_DIR_JOB_DONE;
+        walker->ready++;
+        eina_condition_broadcast(&walker->cond);
+     }
+   eina_lock_release(&walker->lock);
+
+   return NULL;
+}
+
+static void
+_eio_dir_walker_init(Eio_Dir_Walker *walker,
+                     Eina_Iterator *(*Eina_File_Ls)(const char *target))
+{
+   memset(walker, 0, sizeof (Eio_Dir_Walker));
+   walker->ls = Eina_File_Ls;
+}
+
+static void
+_eio_dir_walker_workers_start(Eio_Dir_Walker *walker)
+{
+   unsigned int count;
+
+   walker->workers_tried = EINA_TRUE;
+
+   count = eina_cpu_count();
+   if (count > EIO_DIR_WORKERS_MAX) count = EIO_DIR_WORKERS_MAX;
+   /* the walking thread does its share of listing too */
+   if (count < 2) return;
+   count--;
+
+   if (!eina_lock_new(&walker->lock)) return;
+   if (!eina_condition_new(&walker->cond, &walker->lock))
+     {
+        eina_lock_free(&walker->lock);
+        return;
+     }
+
+   for (walker->workers_count = 0; walker->workers_count < count; walker->workers_count++)
+     if (!eina_thread_create(&walker->workers[walker->workers_count],
+                             EINA_THREAD_BACKGROUND, -1,
+                             _eio_dir_worker, walker))
+       break;
+
+   if (!walker->workers_count)
+     {
+        eina_condition_free(&walker->cond);
+        eina_lock_free(&walker->lock);
+     }
+}
+
+static void
+_eio_dir_walker_shutdown(Eio_Dir_Walker *walker)
+{
+   unsigned int i;
+
+   if (!walker->workers_count) return;
+
+   eina_lock_take(&walker->lock);
+   walker->stop = EINA_TRUE;
+   eina_condition_broadcast(&walker->cond);
+   eina_lock_release(&walker->lock);
+
+   for (i = 0; i < walker->workers_count; i++)
+     eina_thread_join(walker->workers[i]);
+
+   /* every job is dropped by the walk before we get here */
+   walker->todo = eina_list_free(walker->todo);
+
+   eina_condition_free(&walker->cond);
+   eina_lock_free(&walker->lock);
+}
+
+/* Queue the given jobs in front of everything else, as a depth first
+ * walk needs them before the remaining siblings of their parent. */
+static void
+_eio_dir_walker_queue(Eio_Dir_Walker *walker, Eina_List *jobs)
+{
+   Eio_Dir_Job *job;
+   Eina_List *l;
+
+   if (!walker->workers_tried && eina_list_count(jobs) > 1)
+     _eio_dir_walker_workers_start(walker);
+   if (!walker->workers_count) return;
+
+   eina_lock_take(&walker->lock);
+   EINA_LIST_REVERSE_FOREACH(jobs, l, job)
+     walker->todo = eina_list_prepend(walker->todo, job);
+   eina_condition_broadcast(&walker->cond);
+   eina_lock_release(&walker->lock);
+}
+
+static void
+_eio_dir_walker_wait(Eio_Dir_Walker *walker, Eio_Dir_Job *job)
+{
+   if (!walker->workers_count)
+     {
+        _eio_dir_job_run(walker, job);
+        return;
+     }
+
+   eina_lock_take(&walker->lock);
+   if (job->state == EIO_DIR_JOB_WAITING)
+     {
+        /* nobody got to it yet, do it ourself instead of waiting */
+        walker->todo = eina_list_remove(walker->todo, job);
+        job->state = EIO_DIR_JOB_RUNNING;
+        eina_lock_release(&walker->lock);
+
+        _eio_dir_job_run(walker, job);
+        return;
+     }
+
+   while (job->state != EIO_DIR_JOB_DONE)
+     eina_condition_wait(&walker->cond);
+   walker->ready--;
+   eina_condition_broadcast(&walker->cond);
+   eina_lock_release(&walker->lock);
+}
+
+/* Forget about a job that may still be queued or processed by a worker */
+static void
+_eio_dir_walker_drop(Eio_Dir_Walker *walker, Eio_Dir_Job *job)
+{
+   if (walker->workers_count)
+     {
+        eina_lock_take(&walker->lock);
+        if (job->state == EIO_DIR_JOB_WAITING)
+          walker->todo = eina_list_remove(walker->todo, job);
+        else
+          {
+             while (job->state != EIO_DIR_JOB_DONE)
+               eina_condition_wait(&walker->cond);
+             walker->ready--;
+             eina_condition_broadcast(&walker->cond);
+          }
+        eina_lock_release(&walker->lock);
+     }
+
+   _eio_dir_job_free(job);
+}
+
+static Eina_Bool
+_eio_dir_walker_ls(Eio_Dir_Walker *walker,
+                   Ecore_Thread *thread,
+                   Eio_File *common,
+                   Eio_Filter_Direct_Cb filter_cb,
+                   void *data,
+                   Eio_Dir_Job *job)
+{
+   Eina_File_Direct_Info *info = &walker->info;
+   Eina_Iterator *it;
+   Eio_Dir_Entry *entry;
+   Eina_List *dirs = NULL;
+   const unsigned char *names;
+
+   _eio_dir_walker_wait(walker, job);
+   if (!job->names)
+     {
+        errno = job->error;
+        eio_file_thread_error(common, thread);
+        return EINA_FALSE;
+     }
+
+   /* filter can use the container to stat entries relative to it */
+   it = walker->ls(job->path);
+   if (!it)
+     {
+        eio_file_thread_error(common, thread);
+        return EINA_FALSE;
+     }
+
+   eio_file_container_set(common, eina_iterator_container_get(it));
+
+   names = eina_binbuf_string_get(job->names);
+   EINA_INARRAY_FOREACH(&job->entries, entry)
+     {
+        Eina_Bool filter = EINA_TRUE;
+
+        info->path_length = entry->path_length;
+        info->name_start = entry->name_start;
+        info->name_length = entry->path_length - entry->name_start;
+        info->type = entry->type;
+        memcpy(info->path, names + entry->offset, entry->path_length + 1);
+
         filter = filter_cb(data, common, info);
         if (filter && info->type == EINA_FILE_DIR)
-          dirs = eina_list_append(dirs, eina_stringshare_add(info->path));
+          {
+             Eio_Dir_Job *sub;
+
+             sub = _eio_dir_job_new(info->path);
+             if (sub) dirs = eina_list_append(dirs, sub);
+          }
 
         if (ecore_thread_check(thread))
           goto on_error;
@@ -116,27 +412,73 @@ _eio_file_recursiv_ls(Ecore_Thread *thread,
    eina_iterator_free(it);
    it = NULL;
 
-   EINA_LIST_FREE(dirs, dir)
+   /* the listing is not needed anymore, release memory before going deeper */
+   eina_inarray_flush(&job->entries);
+   eina_binbuf_free(job->names);
+   job->names = NULL;
+
+   _eio_dir_walker_queue(walker, dirs);
+
+   while (dirs)
      {
-       Eina_Bool err;
+        Eio_Dir_Job *sub = eina_list_data_get(dirs);
+        Eina_Bool err;
 
-       err = !_eio_file_recursiv_ls(thread, common, filter_cb, Eina_File_Ls, data, dir);
+        dirs = eina_list_remove_list(dirs, dirs);
 
-       eina_stringshare_del(dir);
-       if (err) goto on_error;
+        err = !_eio_dir_walker_ls(walker, thread, common, filter_cb, data, sub);
+
+        _eio_dir_job_free(sub);
+        if (err) goto on_error;
      }
 
    return EINA_TRUE;
 
  on_error:
-   if (it) eina_iterator_free(it);
+   if (it)
+     {
+        eio_file_container_set(common, NULL);
+        eina_iterator_free(it);
+     }
 
-   EINA_LIST_FREE(dirs, dir)
-     eina_stringshare_del(dir);
+   while (dirs)
+     {
+        _eio_dir_walker_drop(walker, eina_list_data_get(dirs));
+        dirs = eina_list_remove_list(dirs, dirs);
+     }
 
    return EINA_FALSE;
 }
 
+static Eina_Bool
+_eio_file_recursiv_ls(Ecore_Thread *thread,
+                      Eio_File *common,
+                      Eio_Filter_Direct_Cb filter_cb,
+		      Eina_Iterator *(*Eina_File_Ls)(const char *target),
+                      void *data,
+                      const char *target)
+{
+   Eio_Dir_Walker walker;
+   Eio_Dir_Job *job;
+   Eina_Bool r;
+
+   job = _eio_dir_job_new(target);
+   if (!job)
+     {
+        eio_file_thread_error(common, thread);
+        return EINA_FALSE;
+     }
+
+   _eio_dir_walker_init(&walker, Eina_File_Ls);
+
+   r = _eio_dir_walker_ls(&walker, thread, common, filter_cb, data, job);
+
+   _eio_dir_walker_shutdown(&walker);
+   _eio_dir_job_free(job);
+
+   return r;
+}
+
 
 static Eina_Bool
 _eio_dir_recursiv_ls(Ecore_Thread *thread, Eio_Dir_Copy *copy, const char *target)
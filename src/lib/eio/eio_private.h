@@ -62,6 +62,11 @@ typedef struct stat _eio_stat_t;
 
 #define EIO_PACKED_TIME 0.003
 
+/* Threads listing directories ahead of a recursive walk, and how many
+ * listed directories they may keep around waiting for it */
+#define EIO_DIR_WORKERS_MAX 4
+#define EIO_DIR_READY_MAX 64
+
 extern int _eio_log_dom_global;
 
 #ifdef EIO_DEFAULT_LOG_COLOR
@@ -478,6 +483,8 @@ void eio_progress_cb(Eio_Progress *progress, Eio_File_Progress *op);
 
 Eina_Bool eio_file_copy_do(Ecore_Thread *thread, Eio_File_Progress *copy);
 
+void _eio_file_struct_2_eina(Eina_Stat *es, _eio_stat_t *st);
+
 void eio_monitor_init(void);
 void eio_monitor_backend_init(void);
 void eio_monitor_fallback_init(void);
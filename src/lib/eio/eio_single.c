@@ -106,7 +106,7 @@ _eio_file_unlink_error(void *data, Ecore_Thread *thread EINA_UNUSED)
    _eio_unlink_free(l);
 }
 
-static void
+void
 _eio_file_struct_2_eina(Eina_Stat *es, _eio_stat_t *st)
 {
    es->dev = st->st_dev;
@@ -885,11 +885,116 @@ extra_arguments_check(DBusMessage *msg, Eldbus_Signal_Handler *sh)
    return EINA_TRUE;
 }
 
+static inline Eina_Bool
+_signal_handler_match(DBusMessage *msg, Eldbus_Signal_Handler *sh)
+{
+   if (sh->dangling) return EINA_FALSE;
+   if (sh->sender)
+     {
+        if (sh->bus)
+          {
+             if ((sh->bus->unique_id == NULL) ||
+                 (!sh->bus->unique_id[0]) ||
+                 (!dbus_message_has_sender(msg, sh->bus->unique_id)))
+               return EINA_FALSE;
+          }
+        else
+          if (!dbus_message_has_sender(msg, sh->sender)) return EINA_FALSE;
+     }
+   if (sh->path && !dbus_message_has_path(msg, sh->path)) return EINA_FALSE;
+   if (sh->interface && !dbus_message_has_interface(msg, sh->interface))
+     return EINA_FALSE;
+   if (sh->member && !dbus_message_has_member(msg, sh->member))
+     return EINA_FALSE;
+   return extra_arguments_check(msg, sh);
+}
+
+static int
+_signal_handler_serial_cmp(const void *a, const void *b)
+{
+   const Eldbus_Signal_Handler *sh1 = *(const Eldbus_Signal_Handler **)a;
+   const Eldbus_Signal_Handler *sh2 = *(const Eldbus_Signal_Handler **)b;
+
+   if (sh1->serial < sh2->serial) return -1;
+   if (sh1->serial > sh2->serial) return 1;
+   return 0;
+}
+
+static Eina_Hash *
+_signal_index_hash_get(Eldbus_Connection *conn, Eldbus_Signal_Handler *sh,
+                       const char **key)
+{
+   if (sh->path)
+     {
+        *key = sh->path;
+        return conn->signal_paths;
+     }
+   if (sh->member)
+     {
+        *key = sh->member;
+        return conn->signal_members;
+     }
+   *key = NULL;
+   return NULL;
+}
+
+static void
+_signal_index_add(Eldbus_Connection *conn, Eldbus_Signal_Handler *sh)
+{
+   Eina_Hash *hash;
+   Eina_List *bucket;
+   const char *key;
+
+   sh->serial = conn->signal_serial++;
+   hash = _signal_index_hash_get(conn, sh, &key);
+   if (!hash)
+     {
+        conn->signal_wildcards = eina_list_append(conn->signal_wildcards, sh);
+        return;
+     }
+   bucket = eina_hash_find(hash, key);
+   bucket = eina_list_append(bucket, sh);
+   eina_hash_set(hash, key, bucket);
+}
+
+static void
+_signal_index_del(Eldbus_Connection *conn, Eldbus_Signal_Handler *sh)
+{
+   Eina_Hash *hash;
+   Eina_List *bucket;
+   const char *key;
+
+   hash = _signal_index_hash_get(conn, sh, &key);
+   if (!hash)
+     {
+        conn->signal_wildcards = eina_list_remove(conn->signal_wildcards, sh);
+        return;
+     }
+   bucket = eina_hash_find(hash, key);
+   bucket = eina_list_remove(bucket, sh);
+   if (bucket) eina_hash_set(hash, key, bucket);
+   else eina_hash_del_by_key(hash, key);
+}
+
+static Eina_Bool
+_signal_index_bucket_free(const Eina_Hash *hash EINA_UNUSED,
+                          const void *key EINA_UNUSED,
+                          void *data, void *fdata EINA_UNUSED)
+{
+   eina_list_free(data);
+   return EINA_TRUE;
+}
+
 static void
 cb_signal_dispatcher(Eldbus_Connection *conn, DBusMessage *msg)
 {
    Eldbus_Message *eldbus_msg;
-   Eina_Inlist *next;
+   Eldbus_Signal_Handler *stack_candidates[32];
+   Eldbus_Signal_Handler **candidates = stack_candidates;
+   Eldbus_Signal_Handler *sh;
+   Eina_List *by_path = NULL, *by_member = NULL, *l;
+   const char *path, *member;
+   unsigned int count, i;
 
    eldbus_msg = eldbus_message_new(EINA_FALSE);
    EINA_SAFETY_ON_NULL_RETURN(eldbus_msg);
@@ -901,42 +1006,39 @@ cb_signal_dispatcher(Eldbus_Connection *conn, DBusMessage *msg)
    eldbus_connection_ref(conn);
    eldbus_init();
    /*
-    * Do the walking open-coded so we don't crash if a callback
-    * removes other signal handlers from the list and we don't own
-    * yet a reference to them.
+    * Only handlers indexed under the signal's path or member, plus the
+    * ones matching on neither, can match. Take a reference on each of
+    * them before calling anything so callbacks may remove handlers
+    * freely, then call them in the order they were added.
     */
-   next = conn->signal_handlers;
-   while (next != NULL)
+   path = dbus_message_get_path(msg);
+   member = dbus_message_get_member(msg);
+   if (path) by_path = eina_hash_find(conn->signal_paths, path);
+   if (member) by_member = eina_hash_find(conn->signal_members, member);
+   count = eina_list_count(by_path) + eina_list_count(by_member) +
+     eina_list_count(conn->signal_wildcards);
+   if (count > EINA_C_ARRAY_LENGTH(stack_candidates))
      {
-        Eldbus_Signal_Handler *sh;
-
-        sh = EINA_INLIST_CONTAINER_GET(next, Eldbus_Signal_Handler);
-        next = next->next;
-
-        if (sh->dangling) continue;
-        if (sh->sender)
-          {
-             if (sh->bus)
-               {
-                  if ((sh->bus->unique_id == NULL) ||
-                      (!sh->bus->unique_id[0]) ||
-                      (!dbus_message_has_sender(msg, sh->bus->unique_id)))
-                    continue;
-               }
-             else
-               if (!dbus_message_has_sender(msg, sh->sender)) continue;
-          }
-        if (sh->path && !dbus_message_has_path(msg, sh->path)) continue;
-        if (sh->interface && !dbus_message_has_interface(msg, sh->interface))
-          continue;
-        if (sh->member && !dbus_message_has_member(msg, sh->member)) continue;
-        if (!extra_arguments_check(msg, sh)) continue;
+        candidates = malloc(count * sizeof(Eldbus_Signal_Handler *));
+        if (!candidates) goto end;
+     }
+   i = 0;
+   EINA_LIST_FOREACH(by_path, l, sh)
+     candidates[i++] = eldbus_signal_handler_ref(sh);
+   EINA_LIST_FOREACH(by_member, l, sh)
+     candidates[i++] = eldbus_signal_handler_ref(sh);
+   EINA_LIST_FOREACH(conn->signal_wildcards, l, sh)
+     candidates[i++] = eldbus_signal_handler_ref(sh);
+   if (count > 1)
+     qsort(candidates, count, sizeof(Eldbus_Signal_Handler *),
+           _signal_handler_serial_cmp);
+
+   for (i = 0; i < count; i++)
+     {
+        sh = candidates[i];
+        if (!_signal_handler_match(msg, sh)) continue;
 
-        eldbus_signal_handler_ref(sh);
         sh->cb((void *)sh->cb_data, eldbus_msg);
-        /* update next signal handler because the list may have changed */
-        next = EINA_INLIST_GET(sh)->next;
-        eldbus_signal_handler_unref(sh);
 
         /*
          * Rewind iterator so another signal handler matching the same signal
@@ -946,6 +1048,11 @@ cb_signal_dispatcher(Eldbus_Connection *conn, DBusMessage *msg)
                                &eldbus_msg->iterator->dbus_iterator);
      }
 
+   for (i = 0; i < count; i++)
+     eldbus_signal_handler_unref(candidates[i]);
+   if (candidates != stack_candidates) free(candidates);
+
+end:
    eldbus_message_unref(eldbus_msg);
    eldbus_connection_unref(conn);
    eldbus_shutdown();
@@ -1080,6 +1187,8 @@ _connection_get(Eldbus_Connection_Type type, const char *address, Eina_Bool shar
    conn->shared = !!shared;
    EINA_MAGIC_SET(conn, ELDBUS_CONNECTION_MAGIC);
    conn->names = eina_hash_string_superfast_new(NULL);
+   conn->signal_paths = eina_hash_string_superfast_new(NULL);
+   conn->signal_members = eina_hash_string_superfast_new(NULL);
    eldbus_connection_setup(conn);
 
    eldbus_signal_handler_add(conn, NULL, DBUS_PATH_LOCAL, DBUS_INTERFACE_LOCAL,
@@ -1258,6 +1367,13 @@ _eldbus_connection_free(Eldbus_Connection *conn)
           ERR("conn=%p alive signal=%p %s.%s path=%s", conn, h, h->interface,
               h->member, h->path);
      }
+   eina_hash_foreach(conn->signal_paths, _signal_index_bucket_free, NULL);
+   eina_hash_free(conn->signal_paths);
+   conn->signal_paths = NULL;
+   eina_hash_foreach(conn->signal_members, _signal_index_bucket_free, NULL);
+   eina_hash_free(conn->signal_members);
+   conn->signal_members = NULL;
+   conn->signal_wildcards = eina_list_free(conn->signal_wildcards);
 
    for (i = 0; i < ELDBUS_CONNECTION_EVENT_LAST; i++)
      {
@@ -1572,6 +1688,7 @@ eldbus_connection_signal_handler_add(Eldbus_Connection *conn, Eldbus_Signal_Hand
    EINA_SAFETY_ON_NULL_RETURN(handler);
    conn->signal_handlers = eina_inlist_append(conn->signal_handlers,
                                               EINA_INLIST_GET(handler));
+   _signal_index_add(conn, handler);
 }
 
 void
@@ -1590,6 +1707,7 @@ eldbus_connection_signal_handler_del(Eldbus_Connection *conn, Eldbus_Signal_Hand
    EINA_SAFETY_ON_NULL_RETURN(handler);
    conn->signal_handlers = eina_inlist_remove(conn->signal_handlers,
                                               EINA_INLIST_GET(handler));
+   _signal_index_del(conn, handler);
 }
 
 void
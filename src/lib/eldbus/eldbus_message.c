@@ -66,6 +66,7 @@ eldbus_message_init(void)
 void
 eldbus_message_shutdown(void)
 {
+   _message_iter_struct_desc_cache_shutdown();
 }
 
 static Eldbus_Message_Iter *
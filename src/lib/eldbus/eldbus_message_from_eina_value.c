@@ -43,6 +43,38 @@ _compatible_type(int dbus_type, const Eina_Value_Type *value_type)
      }
 }
 
+/* Arrays of fixed size types are stored by Eina_Value_Array exactly as
+ * dbus lays them out, hand the storage over in one go. Booleans are
+ * excluded as they are bytes on our side and 32 bits on the wire. */
+static Eina_Bool
+_fixed_array_append(char type, const Eina_Value *value_array, Eldbus_Message_Iter *array)
+{
+   Eina_Value_Array desc;
+   const void *items;
+
+   switch (type)
+     {
+      case 'y':
+      case 'n':
+      case 'q':
+      case 'i':
+      case 'u':
+      case 'x':
+      case 't':
+      case 'd':
+         break;
+      default:
+         return EINA_FALSE;
+     }
+   if (!eina_value_pget(value_array, &desc)) return EINA_FALSE;
+   if (!_compatible_type(type, desc.subtype)) return EINA_FALSE;
+   if (!desc.array) return EINA_FALSE;
+
+   items = desc.array->members;
+   return dbus_message_iter_append_fixed_array(&array->dbus_iterator, type,
+                                               &items, desc.array->len);
+}
+
 static Eina_Bool
 _array_append(const char *type, const Eina_Value *value_array, Eldbus_Message_Iter *iter)
 {
@@ -50,6 +82,11 @@ _array_append(const char *type, const Eina_Value *value_array, Eldbus_Message_It
    Eina_Bool ok = eldbus_message_iter_arguments_append(iter, type, &array);
    EINA_SAFETY_ON_FALSE_RETURN_VAL(ok, EINA_FALSE);
    DBG("array of type %c", type[1]);
+   if (_fixed_array_append(type[1], value_array, array))
+     {
+        eldbus_message_iter_container_close(iter, array);
+        return EINA_TRUE;
+     }
    switch (type[1])
      {
       case '{':
@@ -142,9 +142,63 @@ _message_iter_array_to_eina_value(Eldbus_Message_Iter *iter)
    return array_value;
 }
 
+/* Arrays of fixed size types are laid out by dbus exactly as the
+ * Eina_Value_Array storage wants them, copy them in one go. */
+static Eina_Bool
+_message_iter_fixed_array_to_eina_value(char type, Eina_Value *value, Eldbus_Message_Iter *iter)
+{
+   Eina_Value_Array desc;
+   const void *items = NULL;
+   int count = 0;
+   void *dst;
+
+   switch (type)
+     {
+      case 'y':
+      case 'b':
+      case 'n':
+      case 'q':
+      case 'i':
+      case 'u':
+      case 'x':
+      case 't':
+      case 'd':
+         break;
+      default:
+         return EINA_FALSE;
+     }
+   if (!eina_value_pget(value, &desc)) return EINA_FALSE;
+   if (type == 'b')
+     {
+        if (desc.array->member_size != sizeof(uint8_t)) return EINA_FALSE;
+     }
+   else if (desc.array->member_size != _type_size(type))
+     return EINA_FALSE;
+
+   dbus_message_iter_get_fixed_array(&iter->dbus_iterator, &items, &count);
+   if (count <= 0) return EINA_TRUE;
+
+   dst = eina_inarray_grow(desc.array, count);
+   if (!dst) return EINA_FALSE;
+   if (type == 'b')
+     {
+        const dbus_bool_t *src = items;
+        uint8_t *b = dst;
+        int i;
+
+        for (i = 0; i < count; i++)
+          b[i] = !!src[i];
+     }
+   else
+     memcpy(dst, items, count * desc.array->member_size);
+   return EINA_TRUE;
+}
+
 static void
 _message_iter_basic_array_to_eina_value(char type, Eina_Value *value, Eldbus_Message_Iter *iter)
 {
+   if (_message_iter_fixed_array_to_eina_value(type, value, iter)) return;
+
    switch (type)
     {
        case 'i':
@@ -241,11 +295,9 @@ _ops_malloc(const Eina_Value_Struct_Operations *ops EINA_UNUSED, const Eina_Valu
 }
 
 static void
-_ops_free(const Eina_Value_Struct_Operations *ops EINA_UNUSED, const Eina_Value_Struct_Desc *desc, void *memory)
+_struct_desc_unref(Eldbus_Struct_Desc *edesc)
 {
-   Eldbus_Struct_Desc *edesc = (Eldbus_Struct_Desc*) desc;
    edesc->refcount--;
-   free(memory);
    DBG("%p refcount=%d", edesc, edesc->refcount);
    if (edesc->refcount <= 0)
      {
@@ -257,6 +309,13 @@ _ops_free(const Eina_Value_Struct_Operations *ops EINA_UNUSED, const Eina_Value_
      }
 }
 
+static void
+_ops_free(const Eina_Value_Struct_Operations *ops EINA_UNUSED, const Eina_Value_Struct_Desc *desc, void *memory)
+{
+   free(memory);
+   _struct_desc_unref((Eldbus_Struct_Desc*) desc);
+}
+
 static Eina_Value_Struct_Operations operations =
 {
    EINA_VALUE_STRUCT_OPERATIONS_VERSION,
@@ -267,38 +326,104 @@ static Eina_Value_Struct_Operations operations =
    NULL
 };
 
+/* Struct descriptions only depend on the member types, so they are kept
+ * per type string and shared by all the values built from them. The cache
+ * holds one reference on each of them. */
+#define STRUCT_DESC_CACHE_MAX 64
+
+static Eina_Hash *_struct_descs = NULL;
+
+static Eldbus_Struct_Desc *
+_struct_desc_new(const char *types, unsigned int count)
+{
+   Eldbus_Struct_Desc *st_desc;
+   Eina_Value_Struct_Member *members;
+   unsigned int offset = 0, z;
+   char name[16];//arg000 + \0
+
+   st_desc = calloc(1, sizeof(Eldbus_Struct_Desc));
+   if (!st_desc) return NULL;
+   members = malloc(count * sizeof(Eina_Value_Struct_Member));
+   if (!members)
+     {
+        free(st_desc);
+        return NULL;
+     }
+   for (z = 0; z < count; z++)
+     {
+        snprintf(name, 7, ARG, z);
+        members[z].name = strdup(name);
+        offset = _type_offset(types[z], offset);
+        members[z].offset = offset;
+        offset += _type_size(types[z]);
+        members[z].type = _dbus_type_to_eina_value_type(types[z]);
+     }
+   st_desc->base.version = EINA_VALUE_STRUCT_DESC_VERSION;
+   st_desc->base.ops = &operations;
+   st_desc->base.members = members;
+   st_desc->base.member_count = count;
+   st_desc->base.size = offset;
+   return st_desc;
+}
+
+static Eldbus_Struct_Desc *
+_struct_desc_get(const char *types, unsigned int count)
+{
+   Eldbus_Struct_Desc *st_desc;
+
+   if (!_struct_descs)
+     _struct_descs = eina_hash_string_superfast_new(NULL);
+   st_desc = eina_hash_find(_struct_descs, types);
+   if (st_desc) return st_desc;
+
+   st_desc = _struct_desc_new(types, count);
+   if (!st_desc) return NULL;
+   if (eina_hash_population(_struct_descs) < STRUCT_DESC_CACHE_MAX)
+     {
+        st_desc->refcount++;
+        eina_hash_add(_struct_descs, types, st_desc);
+     }
+   return st_desc;
+}
+
+static Eina_Bool
+_struct_desc_cache_free_cb(const Eina_Hash *hash EINA_UNUSED,
+                           const void *key EINA_UNUSED,
+                           void *data, void *fdata EINA_UNUSED)
+{
+   _struct_desc_unref(data);
+   return EINA_TRUE;
+}
+
+void
+_message_iter_struct_desc_cache_shutdown(void)
+{
+   if (!_struct_descs) return;
+   eina_hash_foreach(_struct_descs, _struct_desc_cache_free_cb, NULL);
+   eina_hash_free(_struct_descs);
+   _struct_descs = NULL;
+}
+
 Eina_Value *
 _message_iter_struct_to_eina_value(Eldbus_Message_Iter *iter)
 {
    int type;
    Eina_Value *value_st = NULL;
-   Eina_Array *st_members = eina_array_new(1);
-   unsigned int offset = 0, z;
+   Eina_Strbuf *st_types = eina_strbuf_new();
+   unsigned int z;
    char name[16];//arg000 + \0
-   Eina_Value_Struct_Member *members;
    Eldbus_Struct_Desc *st_desc;
    Eina_Array *st_values = eina_array_new(1);
 
    DBG("begin struct");
-   st_desc = calloc(1, sizeof(Eldbus_Struct_Desc));
-   st_desc->base.version = EINA_VALUE_STRUCT_DESC_VERSION;
-   st_desc->base.ops = &operations;
 
-   //create member list
+   //collect member types and values
    z = 0;
    while ((type = dbus_message_iter_get_arg_type(&iter->dbus_iterator)) != DBUS_TYPE_INVALID)
      {
-        Eina_Value_Struct_Member *m;
         Eina_Value *v;
 
-        m = calloc(1, sizeof(Eina_Value_Struct_Member));
-        snprintf(name, 7, ARG, z);
-        m->name = strdup(name);
-        offset = _type_offset(type, offset);
-        m->offset = offset;
-        offset += _type_size(type);
-        m->type = _dbus_type_to_eina_value_type(type);
-        eina_array_push(st_members, m);
+        eina_strbuf_append_char(st_types, type);
 
         DBG("type = %c", type);
         switch (type)
@@ -411,39 +536,27 @@ _message_iter_struct_to_eina_value(Eldbus_Message_Iter *iter)
         z++;
      }
 
-   if (!z)
-     {
-        free(st_desc);
-        goto end;
-     }
-
-   members = malloc(eina_array_count(st_members) * sizeof(Eina_Value_Struct_Member));
-   for (z = 0; z < eina_array_count(st_members); z++)
-     {
-        Eina_Value_Struct_Member *m = eina_array_data_get(st_members, z);
-        members[z].name = m->name;
-        members[z].offset = m->offset;
-        members[z].type = m->type;
-        free(m);
-     }
+   if (!z) goto end;
 
    //setup
-   st_desc->base.members = members;
-   st_desc->base.member_count = eina_array_count(st_members);
-   st_desc->base.size = offset;
-   value_st = eina_value_struct_new((Eina_Value_Struct_Desc *)st_desc);
+   st_desc = _struct_desc_get(eina_strbuf_string_get(st_types), z);
+   if (st_desc)
+     value_st = eina_value_struct_new((Eina_Value_Struct_Desc *)st_desc);
 
    //filling with data
    for (z = 0; z < eina_array_count(st_values); z++)
      {
         Eina_Value *v = eina_array_data_get(st_values, z);
-        sprintf(name, ARG, z);
-        eina_value_struct_value_set(value_st, name, v);
+        if (value_st)
+          {
+             sprintf(name, ARG, z);
+             eina_value_struct_value_set(value_st, name, v);
+          }
         eina_value_free(v);
      }
 
 end:
-   eina_array_free(st_members);
+   eina_strbuf_free(st_types);
    eina_array_free(st_values);
    DBG("end struct");
    return value_st;
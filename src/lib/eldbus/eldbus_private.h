@@ -77,6 +77,7 @@ Eldbus_Message         *_eldbus_connection_send_and_block(Eldbus_Connection *con
 
 Eldbus_Message_Iter    *eldbus_message_iter_sub_iter_get(Eldbus_Message_Iter *iter);
 Eina_Value             *_message_iter_struct_to_eina_value(Eldbus_Message_Iter *iter);
+void                   _message_iter_struct_desc_cache_shutdown(void);
 Eina_Bool              _message_iter_from_eina_value(const char *signature, Eldbus_Message_Iter *iter, const Eina_Value *value);
 Eina_Bool              _message_iter_from_eina_value_struct(const char *signature, Eldbus_Message_Iter *iter, const Eina_Value *value);
 
@@ -51,6 +51,10 @@ struct _Eldbus_Connection
    Eina_Inlist                   *data;
    Eina_Inlist                   *cbs_free;
    Eina_Inlist                   *signal_handlers;
+   Eina_Hash                     *signal_paths; //Eina_List of Eldbus_Signal_Handler by path
+   Eina_Hash                     *signal_members; //same by member, for handlers without path
+   Eina_List                     *signal_wildcards; //handlers without path nor member
+   unsigned int                   signal_serial;
    Eina_Inlist                   *pendings;
    Eina_Inlist                   *fd_handlers;
    Eina_Inlist                   *timeouts;
@@ -97,6 +101,7 @@ struct _Eldbus_Signal_Handler
    Eldbus_Connection_Name    *bus;
    const void               *cb_data;
    Eina_Inlist              *cbs_free;
+   unsigned int              serial; /* registration order on conn */
    Eina_Bool                 dangling;
 };
 
@@ -211,33 +211,157 @@ _image_place(Evas_Object *obj,
      }
 }
 
+static void
+_grid_item_busy_begin(Efl_Ui_Image_Zoomable_Grid_Item *git)
+{
+   Evas_Object *obj = git->obj;
+
+   EFL_UI_IMAGE_ZOOMABLE_DATA_GET(obj, sd);
+   ELM_WIDGET_DATA_GET_OR_RETURN(obj, wd);
+
+   if (git->busy) return;
+   git->busy = 1;
+   sd->preload_num++;
+   if (sd->preload_num == 1)
+     {
+        if (elm_widget_is_legacy(obj))
+          edje_object_signal_emit
+             (wd->resize_obj,
+              "elm,state,busy,start", "elm");
+        else
+          edje_object_signal_emit
+             (wd->resize_obj,
+              "efl,state,busy,started", "efl");
+
+        efl_event_callback_legacy_call
+         (obj, EFL_UI_IMAGE_ZOOMABLE_EVENT_LOAD_DETAIL, NULL);
+     }
+}
+
+static void
+_grid_item_busy_end(Efl_Ui_Image_Zoomable_Grid_Item *git)
+{
+   Evas_Object *obj = git->obj;
+
+   EFL_UI_IMAGE_ZOOMABLE_DATA_GET(obj, sd);
+   ELM_WIDGET_DATA_GET_OR_RETURN(obj, wd);
+
+   if (!git->busy) return;
+   git->busy = 0;
+   sd->preload_num--;
+   if (!sd->preload_num)
+     {
+        if (elm_widget_is_legacy(obj))
+          edje_object_signal_emit
+             (wd->resize_obj,
+              "elm,state,busy,stop", "elm");
+        else
+          edje_object_signal_emit
+             (wd->resize_obj,
+              "efl,state,busy,stopped", "efl");
+
+        efl_event_callback_legacy_call
+         (obj, EFL_UI_IMAGE_ZOOMABLE_EVENT_LOADED_DETAIL, NULL);
+     }
+}
+
+static size_t
+_grid_item_bytes(const Efl_Ui_Image_Zoomable_Grid_Item *git)
+{
+   return (size_t)git->out.w * (size_t)git->out.h * 4;
+}
+
+static void
+_grid_item_drop(Efl_Ui_Image_Zoomable_Grid_Item *git)
+{
+   git->have = 0;
+   evas_object_hide(git->img);
+   evas_object_image_preload(git->img, 1);
+   evas_object_image_file_set(git->img, NULL, NULL);
+}
+
+/* Decoded tiles leaving the viewport are only hidden, so panning back does
+ * not decode them again. The least recently hidden ones are dropped once
+ * the cache grows over EFL_UI_IMAGE_ZOOMABLE_TILE_CACHE_MAX.
+ */
+static void
+_tile_cache_del(Efl_Ui_Image_Zoomable_Data *sd,
+                Efl_Ui_Image_Zoomable_Grid_Item *git)
+{
+   if (!git->cached) return;
+   git->cached = 0;
+   sd->tile_cache.tiles =
+     eina_inlist_remove(sd->tile_cache.tiles, EINA_INLIST_GET(git));
+   sd->tile_cache.size -= _grid_item_bytes(git);
+}
+
+static void
+_tile_cache_add(Efl_Ui_Image_Zoomable_Data *sd,
+                Efl_Ui_Image_Zoomable_Grid_Item *git)
+{
+   evas_object_hide(git->img);
+   if (git->cached) return;
+   git->cached = 1;
+   sd->tile_cache.tiles =
+     eina_inlist_append(sd->tile_cache.tiles, EINA_INLIST_GET(git));
+   sd->tile_cache.size += _grid_item_bytes(git);
+
+   while ((sd->tile_cache.size > EFL_UI_IMAGE_ZOOMABLE_TILE_CACHE_MAX) &&
+          (sd->tile_cache.tiles))
+     {
+        Efl_Ui_Image_Zoomable_Grid_Item *old =
+          EINA_INLIST_CONTAINER_GET(sd->tile_cache.tiles,
+                                    Efl_Ui_Image_Zoomable_Grid_Item);
+
+        _tile_cache_del(sd, old);
+        _grid_item_drop(old);
+     }
+}
+
 static void
 _grid_load(Evas_Object *obj,
            Efl_Ui_Image_Zoomable_Grid *g)
 {
    int x, y;
    Evas_Coord ox, oy, ow, oh, cvx, cvy, cvw, cvh, gw, gh, tx, ty;
+   Evas_Coord pfx, pfy, pfw, pfh, mw, mh;
 
    EFL_UI_IMAGE_ZOOMABLE_DATA_GET(obj, sd);
-   ELM_WIDGET_DATA_GET_OR_RETURN(obj, wd);
 
    evas_object_geometry_get(sd->pan_obj, &ox, &oy, &ow, &oh);
    evas_output_viewport_get(evas_object_evas_get(obj), &cvx, &cvy, &cvw, &cvh);
 
    gw = sd->size.w;
    gh = sd->size.h;
+
+   /* tiles one row/column ahead in the pan direction get loaded too, so
+    * they are decoded by the time they scroll in */
+   mw = mh = g->tsize;
+   if (g->w > 0) mw = (gw * g->tsize) / g->w;
+   if (g->h > 0) mh = (gh * g->tsize) / g->h;
+   pfx = cvx;
+   pfy = cvy;
+   pfw = cvw;
+   pfh = cvh;
+   if (sd->pan_dx) pfw += mw;
+   if (sd->pan_dx < 0) pfx -= mw;
+   if (sd->pan_dy) pfh += mh;
+   if (sd->pan_dy < 0) pfy -= mh;
+
    for (y = 0; y < g->gh; y++)
      {
         for (x = 0; x < g->gw; x++)
           {
              int tn, xx, yy, ww, hh;
-             Eina_Bool visible = EINA_FALSE;
+             Efl_Ui_Image_Zoomable_Grid_Item *git;
+             Eina_Bool visible = EINA_FALSE, needed = EINA_FALSE;
 
              tn = (y * g->gw) + x;
-             xx = g->grid[tn].out.x;
-             yy = g->grid[tn].out.y;
-             ww = g->grid[tn].out.w;
-             hh = g->grid[tn].out.h;
+             git = &(g->grid[tn]);
+             xx = git->out.x;
+             yy = git->out.y;
+             ww = git->out.w;
+             hh = git->out.h;
              if ((gw != g->w) && (g->w > 0))
                {
                   tx = xx;
@@ -254,62 +378,51 @@ _grid_load(Evas_Object *obj,
                                      yy - sd->pan_y + oy,
                                      ww, hh, cvx, cvy, cvw, cvh))
                visible = EINA_TRUE;
-             if ((visible) && (!g->grid[tn].have) && (!g->grid[tn].want))
+             if ((visible) ||
+                 (ELM_RECTS_INTERSECT(xx - sd->pan_x + ox,
+                                      yy - sd->pan_y + oy,
+                                      ww, hh, pfx, pfy, pfw, pfh)))
+               needed = EINA_TRUE;
+             git->visible = visible;
+
+             if ((needed) && (!git->have) && (!git->want))
                {
-                  g->grid[tn].want = 1;
-                  evas_object_hide(g->grid[tn].img);
-                  evas_object_image_file_set(g->grid[tn].img, NULL, NULL);
+                  git->want = 1;
+                  evas_object_hide(git->img);
+                  evas_object_image_file_set(git->img, NULL, NULL);
                   evas_object_image_load_scale_down_set
-                    (g->grid[tn].img, g->zoom);
+                    (git->img, g->zoom);
                   evas_object_image_load_region_set
-                    (g->grid[tn].img, g->grid[tn].src.x, g->grid[tn].src.y,
-                    g->grid[tn].src.w, g->grid[tn].src.h);
-                  _photocam_image_file_set(g->grid[tn].img, sd);
-                  evas_object_image_preload(g->grid[tn].img, 0);
-                  sd->preload_num++;
-                  if (sd->preload_num == 1)
-                    {
-                       if (elm_widget_is_legacy(obj))
-                         edje_object_signal_emit
-                            (wd->resize_obj,
-                             "elm,state,busy,start", "elm");
-                       else
-                         edje_object_signal_emit
-                            (wd->resize_obj,
-                             "efl,state,busy,started", "efl");
-
-                       efl_event_callback_legacy_call
-                        (obj, EFL_UI_IMAGE_ZOOMABLE_EVENT_LOAD_DETAIL, NULL);
-                    }
+                    (git->img, git->src.x, git->src.y,
+                    git->src.w, git->src.h);
+                  _photocam_image_file_set(git->img, sd);
+                  evas_object_image_preload(git->img, 0);
+                  /* prefetched tiles do not make the widget busy */
+                  if (visible) _grid_item_busy_begin(git);
                }
-             else if ((g->grid[tn].want) && (!visible))
+             else if (git->want)
                {
-                  sd->preload_num--;
-                  if (!sd->preload_num)
+                  if (visible)
+                    _grid_item_busy_begin(git);
+                  else
+                    _grid_item_busy_end(git);
+                  if (!needed)
                     {
-                       if (elm_widget_is_legacy(obj))
-                         edje_object_signal_emit
-                            (wd->resize_obj,
-                             "elm,state,busy,stop", "elm");
-                       else
-                         edje_object_signal_emit
-                            (wd->resize_obj,
-                             "efl,state,busy,stopped", "efl");
-
-                       efl_event_callback_legacy_call
-                        (obj, EFL_UI_IMAGE_ZOOMABLE_EVENT_LOADED_DETAIL, NULL);
+                       git->want = 0;
+                       evas_object_hide(git->img);
+                       evas_object_image_preload(git->img, 1);
+                       evas_object_image_file_set(git->img, NULL, NULL);
                     }
-                  g->grid[tn].want = 0;
-                  evas_object_hide(g->grid[tn].img);
-                  evas_object_image_preload(g->grid[tn].img, 1);
-                  evas_object_image_file_set(g->grid[tn].img, NULL, NULL);
                }
-             else if ((g->grid[tn].have) && (!visible))
+             else if (git->have)
                {
-                  g->grid[tn].have = 0;
-                  evas_object_hide(g->grid[tn].img);
-                  evas_object_image_preload(g->grid[tn].img, 1);
-                  evas_object_image_file_set(g->grid[tn].img, NULL, NULL);
+                  if (visible)
+                    {
+                       _tile_cache_del(sd, git);
+                       evas_object_show(git->img);
+                    }
+                  else
+                    _tile_cache_add(sd, git);
                }
           }
      }
@@ -399,6 +512,8 @@ EOLIAN static void
 _efl_ui_image_zoomable_pan_efl_ui_pan_pan_position_set(Eo *obj, Efl_Ui_Image_Zoomable_Pan_Data *psd, Eina_Position2D pos)
 {
    if ((pos.x == psd->wsd->pan_x) && (pos.y == psd->wsd->pan_y)) return;
+   psd->wsd->pan_dx = (pos.x > psd->wsd->pan_x) - (pos.x < psd->wsd->pan_x);
+   psd->wsd->pan_dy = (pos.y > psd->wsd->pan_y) - (pos.y < psd->wsd->pan_y);
    psd->wsd->pan_x = pos.x;
    psd->wsd->pan_y = pos.y;
    evas_object_smart_changed(obj);
@@ -475,7 +590,6 @@ _grid_clear(Evas_Object *obj,
    int x, y;
 
    EFL_UI_IMAGE_ZOOMABLE_DATA_GET(obj, sd);
-   ELM_WIDGET_DATA_GET_OR_RETURN(obj, wd);
 
    if (!g->grid) return;
    for (y = 0; y < g->gh; y++)
@@ -485,25 +599,9 @@ _grid_clear(Evas_Object *obj,
              int tn;
 
              tn = (y * g->gw) + x;
+             _tile_cache_del(sd, &(g->grid[tn]));
+             _grid_item_busy_end(&(g->grid[tn]));
              evas_object_del(g->grid[tn].img);
-             if (g->grid[tn].want)
-               {
-                  sd->preload_num--;
-                  if (!sd->preload_num)
-                    {
-                       if (elm_widget_is_legacy(obj))
-                         edje_object_signal_emit
-                            (wd->resize_obj,
-                             "elm,state,busy,stop", "elm");
-                       else
-                         edje_object_signal_emit
-                            (wd->resize_obj,
-                             "efl,state,busy,stopped", "efl");
-
-                       efl_event_callback_legacy_call
-                         (obj, EFL_UI_IMAGE_ZOOMABLE_EVENT_LOAD_DETAIL, NULL);
-                    }
-               }
           }
      }
 
@@ -520,28 +618,16 @@ _tile_preloaded_cb(void *data,
 {
    Efl_Ui_Image_Zoomable_Grid_Item *git = data;
    EFL_UI_IMAGE_ZOOMABLE_DATA_GET(git->obj, sd);
-   ELM_WIDGET_DATA_GET_OR_RETURN(git->obj, wd);
 
    if (git->want)
      {
         git->want = 0;
-        evas_object_show(git->img);
         git->have = 1;
-        sd->preload_num--;
-        if (!sd->preload_num)
-          {
-             if (elm_widget_is_legacy(git->obj))
-               edje_object_signal_emit
-                  (wd->resize_obj, "elm,state,busy,stop",
-                   "elm");
-             else
-               edje_object_signal_emit
-                  (wd->resize_obj, "efl,state,busy,stopped",
-                   "efl");
-
-             efl_event_callback_legacy_call
-               (git->obj, EFL_UI_IMAGE_ZOOMABLE_EVENT_LOADED_DETAIL, NULL);
-          }
+        if (git->visible)
+          evas_object_show(git->img);
+        else
+          _tile_cache_add(sd, git);
+        _grid_item_busy_end(git);
      }
 }
 
@@ -28,8 +28,13 @@ typedef struct _Efl_Ui_Image_Zoomable_Pan_Data       Efl_Ui_Image_Zoomable_Pan_D
 typedef struct _Efl_Ui_Image_Zoomable_Grid           Efl_Ui_Image_Zoomable_Grid;
 typedef struct _Efl_Ui_Image_Zoomable_Grid_Item      Efl_Ui_Image_Zoomable_Grid_Item;
 
+/* decoded tiles out of the viewport are kept hidden up to this many bytes */
+#define EFL_UI_IMAGE_ZOOMABLE_TILE_CACHE_MAX (32 * 1024 * 1024)
+
 struct _Efl_Ui_Image_Zoomable_Grid_Item
 {
+   EINA_INLIST; /* in the tile cache, when cached */
+
    Evas_Object             *obj;
    Efl_Ui_Image_Zoomable_Data       *sd;
    Evas_Object             *img;
@@ -41,6 +46,9 @@ struct _Efl_Ui_Image_Zoomable_Grid_Item
 
    Eina_Bool                want : 1;
    Eina_Bool                have : 1;
+   Eina_Bool                busy : 1; /* counted in preload_num */
+   Eina_Bool                visible : 1;
+   Eina_Bool                cached : 1;
 };
 
 struct _Efl_Ui_Image_Zoomable_Grid
@@ -132,6 +140,13 @@ struct _Efl_Ui_Image_Zoomable_Data
    Eina_List             *grids;
    Efl_Gfx_Image_Orientation   orient;
 
+   struct
+   {
+      Eina_Inlist *tiles; /* hidden decoded tiles, oldest first */
+      size_t       size;
+   } tile_cache;
+   int                   pan_dx, pan_dy; /* direction of the last pan */
+
    Eina_Bool    main_load_pending : 1;
    Eina_Bool    longpressed : 1;
    Eina_Bool    do_gesture : 1;
@@ -17,7 +17,8 @@ typedef struct {
    Api_Callbacks callbacks;
 
    Eina_Future *rebuild_absolut_size;
-   int *size_cache;
+   int *size_tree;
+   int *size_items;
    Efl_Gfx_Entity *last_group;
    Efl_Ui_Win *window;
    Evas *canvas;
@@ -36,81 +37,189 @@ typedef struct {
 } Efl_Ui_Position_Manager_List_Data;
 
 /*
- * The here used cache is a sum map
- * Every element in the cache contains the sum of the previous element, and the size of the current item
- * This is usefull as a lookup of all previous items is O(1).
- * The tradeoff that makes the cache performant here is, that we only need to walk the whole list of items once in the beginning.
- * Every other walk of the items is at max the maximum number of items you get into the maximum distance between the average item size and a actaul item size.
+ * The here used cache is a Fenwick tree over the item sizes.
+ * The sum of all previous items, the update of a single item size and the lookup of the item at a given
+ * offset are all O(log n), so an item changing its size does not require to walk the whole list of items again.
+ * Only the first build of the cache (and any add or removal of items) has to walk all the items once.
+ * The size of every single item is kept next to it, to be able to compute the delta of an update.
  */
 
+static inline unsigned int
+_size_tree_lowbit(unsigned int idx)
+{
+   return idx & (~idx + 1);
+}
+
+static void
+_size_tree_add(Efl_Ui_Position_Manager_List_Data *pd, unsigned int idx, int delta)
+{
+   for (idx++; idx <= pd->size; idx += _size_tree_lowbit(idx))
+     pd->size_tree[idx] += delta;
+}
+
+/* Find the biggest number of items whose sizes sum up to less than (or up to) value */
+static unsigned int
+_size_tree_search(Efl_Ui_Position_Manager_List_Data *pd, int value, Eina_Bool inclusive)
+{
+   unsigned int pos = 0, bit = 1;
+   int sum = 0;
+
+   while ((bit << 1) <= pd->size) bit <<= 1;
+
+   for (; bit; bit >>= 1)
+     {
+        unsigned int next = pos + bit;
+        int nsum;
+
+        if (next > pd->size) continue;
+        nsum = sum + pd->size_tree[next];
+        if ((nsum < value) || (inclusive && nsum == value))
+          {
+             pos = next;
+             sum = nsum;
+          }
+     }
+
+   return pos;
+}
+
 static void
 cache_invalidate(Eo *obj EINA_UNUSED, Efl_Ui_Position_Manager_List_Data *pd)
 {
-   if (pd->size_cache)
-     free(pd->size_cache);
-   pd->size_cache = NULL;
+   free(pd->size_tree);
+   pd->size_tree = NULL;
+   free(pd->size_items);
+   pd->size_items = NULL;
+}
+
+static int
+cache_access(Eo *obj EINA_UNUSED, Efl_Ui_Position_Manager_List_Data *pd, unsigned int idx)
+{
+   int sum = 0;
+
+   EINA_SAFETY_ON_FALSE_RETURN_VAL(idx <= pd->size, 0);
+   if (!pd->size_tree) return 0;
+
+   for (; idx > 0; idx -= _size_tree_lowbit(idx))
+     sum += pd->size_tree[idx];
+   return sum;
+}
+
+static inline int
+_item_step_get(Efl_Ui_Position_Manager_List_Data *pd, Eina_Size2D size, int *min)
+{
+   if (pd->dir == EFL_UI_LAYOUT_ORIENTATION_VERTICAL)
+     {
+        if (min) *min = size.w;
+        return size.h;
+     }
+   if (min) *min = size.h;
+   return size.w;
 }
 
 static void
 cache_require(Eo *obj EINA_UNUSED, Efl_Ui_Position_Manager_List_Data *pd)
 {
-   unsigned int i;
+   unsigned int i, j;
    const unsigned int len = 100;
    Efl_Ui_Position_Manager_Size_Batch_Entity size_buffer[len];
    Efl_Ui_Position_Manager_Size_Batch_Result size_result;
 
-   if (pd->size_cache) return;
+   if (pd->size_tree) return;
 
    if (pd->size == 0)
      {
-        pd->size_cache = NULL;
         pd->average_item_size = 0;
         return;
      }
 
-   pd->size_cache = calloc(pd->size + 1, sizeof(int));
-   if (!pd->size_cache) return;
-   pd->size_cache[0] = 0;
+   pd->size_tree = calloc(pd->size + 1, sizeof(int));
+   pd->size_items = calloc(pd->size, sizeof(int));
+   if (!pd->size_tree || !pd->size_items)
+     {
+        cache_invalidate(obj, pd);
+        return;
+     }
    pd->maximum_min_size = 0;
 
    for (i = 0; i < pd->size; ++i)
      {
-        Eina_Size2D size;
         int step;
         int min;
         int buffer_id = i % len;
 
         if (buffer_id == 0)
           {
-             BATCH_ACCESS_SIZE(pd->callbacks, i, pd->size, MIN(len, pd->size - i), EINA_TRUE, size_buffer);
+             size_result = _batch_request_size(pd->callbacks, i, pd->size, MIN(len, pd->size - i), EINA_TRUE, size_buffer);
+             if (size_result.filled_items <= 0)
+               {
+                  ERR("Failed to fetch the size of items from %d", i);
+                  cache_invalidate(obj, pd);
+                  return;
+               }
           }
-       size = size_buffer[buffer_id].size;
+        step = _item_step_get(pd, size_buffer[buffer_id].size, &min);
 
-        if (pd->dir == EFL_UI_LAYOUT_ORIENTATION_VERTICAL)
-          {
-             step = size.h;
-             min = size.w;
-          }
-        else
-          {
-             step = size.w;
-             min = size.h;
-          }
-        pd->size_cache[i + 1] = pd->size_cache[i] + step;
+        pd->size_items[i] = step;
+        pd->size_tree[i + 1] = step;
         pd->maximum_min_size = MAX(pd->maximum_min_size, min);
         /* no point iterating further if size calc can't be done yet */
         //if ((!i) && (!pd->maximum_min_size)) break;
      }
-   pd->average_item_size = pd->size_cache[pd->size]/pd->size;
+
+   /* turn the sizes into a Fenwick tree in place */
+   for (i = 1; i <= pd->size; ++i)
+     {
+        j = i + _size_tree_lowbit(i);
+        if (j <= pd->size)
+          pd->size_tree[j] += pd->size_tree[i];
+     }
+
+   pd->average_item_size = cache_access(obj, pd, pd->size)/pd->size;
    if ((!pd->average_item_size) && (!pd->maximum_min_size))
      cache_invalidate(obj, pd);
 }
 
-static int
-cache_access(Eo *obj EINA_UNUSED, Efl_Ui_Position_Manager_List_Data *pd, unsigned int idx)
+/* Refetch the size of the items from start_id to end_id, return EINA_FALSE if the cache has to be rebuilt */
+static Eina_Bool
+cache_update(Eo *obj EINA_UNUSED, Efl_Ui_Position_Manager_List_Data *pd, unsigned int start_id, unsigned int end_id)
 {
-   EINA_SAFETY_ON_FALSE_RETURN_VAL(idx <= pd->size, 0);
-   return pd->size_cache[idx];
+   unsigned int i;
+   const unsigned int len = 100;
+   Efl_Ui_Position_Manager_Size_Batch_Entity size_buffer[len];
+   Efl_Ui_Position_Manager_Size_Batch_Result size_result;
+
+   if (!pd->size_tree) return EINA_FALSE;
+   if (start_id >= pd->size) return EINA_TRUE;
+   end_id = MIN(end_id + 1, pd->size);
+
+   for (i = start_id; i < end_id; ++i)
+     {
+        int step;
+        int min;
+        int buffer_id = (i - start_id) % len;
+
+        if (buffer_id == 0)
+          {
+             size_result = _batch_request_size(pd->callbacks, i, end_id, MIN(len, end_id - i), EINA_TRUE, size_buffer);
+             if (size_result.filled_items <= 0) return EINA_FALSE;
+          }
+        step = _item_step_get(pd, size_buffer[buffer_id].size, &min);
+
+        if (step != pd->size_items[i])
+          {
+             _size_tree_add(pd, i, step - pd->size_items[i]);
+             pd->size_items[i] = step;
+          }
+        // The biggest minimum size only shrinks back on the next full rebuild
+        pd->maximum_min_size = MAX(pd->maximum_min_size, min);
+     }
+
+   pd->average_item_size = cache_access(obj, pd, pd->size)/pd->size;
+   if ((!pd->average_item_size) && (!pd->maximum_min_size))
+     return EINA_FALSE;
+
+   return EINA_TRUE;
 }
 
 static void
@@ -122,7 +231,7 @@ recalc_absolut_size(Eo *obj, Efl_Ui_Position_Manager_List_Data *pd)
 
    cache_require(obj, pd);
    /* deferred */
-   if (!pd->size_cache) return;
+   if (!pd->size_tree) return;
 
    pd->abs_size = pd->viewport.size;
 
@@ -152,19 +261,17 @@ static inline Vis_Segment
 _search_visual_segment(Eo *obj, Efl_Ui_Position_Manager_List_Data *pd, int relevant_space_size, int relevant_viewport)
 {
    Vis_Segment cur;
-   //based on the average item size, we jump somewhere into the sum cache.
-   //After beeing in there, we are walking back, until we have less space then viewport size
-   cur.start_id = MIN((unsigned int)(relevant_space_size / pd->average_item_size), pd->size);
-   for (; cache_access(obj, pd, cur.start_id) >= relevant_space_size && cur.start_id > 0; cur.start_id --) { }
-
-   //starting on the start id, we are walking down until the sum of elements is bigger than the lower part of the viewport.
-   cur.end_id = cur.start_id;
-   for (; cur.end_id <= pd->size && cache_access(obj, pd, cur.end_id) <= relevant_space_size + relevant_viewport ; cur.end_id ++) { }
+   //the first item is the last one starting before the viewport begins
+   cur.start_id = _size_tree_search(pd, relevant_space_size, EINA_FALSE);
+   cur.start_id = MIN(cur.start_id, pd->size);
+
+   //the last item is the first one ending after the viewport ends
+   cur.end_id = _size_tree_search(pd, relevant_space_size + relevant_viewport, EINA_TRUE) + 1;
    cur.end_id = MAX(cur.end_id, cur.start_id + 1);
    cur.end_id = MIN(cur.end_id, pd->size);
 
    #ifdef DEBUG
-   printf("space_size %d : starting point : %d : cached_space_starting_point %d end point : %d cache_space_end_point %d\n", space_size.h, cur.start_id, pd->size_cache[cur.start_id], cur.end_id, pd->size_cache[cur.end_id]);
+   printf("space_size %d : starting point : %d : cached_space_starting_point %d end point : %d cache_space_end_point %d\n", relevant_space_size, cur.start_id, cache_access(obj, pd, cur.start_id), cur.end_id, cache_access(obj, pd, cur.end_id));
    #endif
    if (relevant_space_size > 0)
      EINA_SAFETY_ON_FALSE_GOTO(cache_access(obj, pd, cur.start_id) <= relevant_space_size, err);
@@ -229,7 +336,7 @@ _position_items(Eo *obj EINA_UNUSED, Efl_Ui_Position_Manager_List_Data *pd, Vis_
         size = size_buffer[buffer_id].size;
         ent = obj_buffer[buffer_id].entity;
 
-        int diff = cache_access(obj, pd, i + 1) - cache_access(obj, pd, i);
+        int diff = pd->size_items ? pd->size_items[i] : 0;
         int real_diff = 0;
         if (pd->dir == EFL_UI_LAYOUT_ORIENTATION_VERTICAL)
           real_diff = size.h;
@@ -482,9 +589,11 @@ _efl_ui_position_manager_list_efl_ui_position_manager_entity_position_single_ite
 }
 
 EOLIAN static void
-_efl_ui_position_manager_list_efl_ui_position_manager_entity_item_size_changed(Eo *obj, Efl_Ui_Position_Manager_List_Data *pd, int start_id EINA_UNUSED, int end_id EINA_UNUSED)
+_efl_ui_position_manager_list_efl_ui_position_manager_entity_item_size_changed(Eo *obj, Efl_Ui_Position_Manager_List_Data *pd, int start_id, int end_id)
 {
-   cache_invalidate(obj, pd);
+   if ((start_id < 0) || (end_id < start_id) ||
+       !cache_update(obj, pd, start_id, end_id))
+     cache_invalidate(obj, pd);
    schedule_recalc_absolut_size(obj, pd);
 }
 
@@ -47,14 +47,14 @@ _elm_code_diff_widget_parse_diff_line(Elm_Code_Line *line, Elm_Code_File *left,
 static void
 _elm_code_diff_widget_parse_diff(Elm_Code_File *diff, Elm_Code_File *left, Elm_Code_File *right)
 {
-   Eina_List *item;
-   Elm_Code_Line *line;
+   Elm_Code_Line **item, *line;
    const char *content;
    unsigned int offset, length;
 
    offset = 0;
-   EINA_LIST_FOREACH(diff->lines, item, line)
+   EINA_INARRAY_FOREACH(diff->lines, item)
      {
+        line = *item;
         content = elm_code_line_text_get(line, &length);
 
         if (length > 0 && (content[0] == 'd' || content[0] == 'i' || content[0] == 'n'))
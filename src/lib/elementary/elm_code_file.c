@@ -35,7 +35,7 @@ static Elm_Code_File_Line_Ending _elm_code_line_ending_get(const char *ending)
 static void _elm_code_file_line_insert_data(Elm_Code_File *file, const char *content, unsigned int length,
                                             unsigned int row, Eina_Bool mapped, void *data)
 {
-   Elm_Code_Line *line, *after;
+   Elm_Code_Line *line;
 
    line = _elm_code_file_line_blank_create(file, row, data);
    if (!line) return;
@@ -53,15 +53,10 @@ static void _elm_code_file_line_insert_data(Elm_Code_File *file, const char *con
         line->length = length;
      }
 
-   if (row == 1)
-     file->lines = eina_list_prepend(file->lines, line);
-   else if (row == eina_list_count(file->lines) + 1)
-     file->lines = eina_list_append(file->lines, line);
+   if (!row || row > eina_inarray_count(file->lines))
+     eina_inarray_push(file->lines, &line);
    else
-     {
-        after = eina_list_nth(file->lines, row - 2);
-        file->lines = eina_list_append_relative(file->lines, line, after);
-     }
+     eina_inarray_insert_at(file->lines, row - 1, &line);
 
    if (file->parent)
      {
@@ -113,6 +108,13 @@ EAPI Elm_Code_File *elm_code_file_new(Elm_Code *code)
 
    ret = calloc(1, sizeof(Elm_Code_File));
    if (!ret) return NULL;
+
+   ret->lines = eina_inarray_new(sizeof(Elm_Code_Line *), ELM_CODE_FILE_LINES_STEP);
+   if (!ret->lines)
+     {
+        free(ret);
+        return NULL;
+     }
    code->file = ret;
    ret->parent = code;
 
@@ -151,7 +153,7 @@ EAPI Elm_Code_File *elm_code_file_open(Elm_Code *code, const char *path)
              ecl = _elm_code_file_line_blank_create(ret, ++lastindex, NULL);
              if (!ecl) continue;
 
-             ret->lines = eina_list_append(ret->lines, ecl);
+             eina_inarray_push(ret->lines, &ecl);
           }
 
         _elm_code_file_line_insert_data(ret, line->start, line->length, lastindex = line->index, EINA_TRUE, NULL);
@@ -168,9 +170,8 @@ EAPI Elm_Code_File *elm_code_file_open(Elm_Code *code, const char *path)
 
 EAPI void elm_code_file_save(Elm_Code_File *file)
 {
-   Eina_List *item;
    Elm_Code *code;
-   Elm_Code_Line *line_item;
+   Elm_Code_Line **item, *line_item;
    FILE *out;
    const char *path, *content, *crchars;
    char *tmp;
@@ -197,8 +198,9 @@ EAPI void elm_code_file_save(Elm_Code_File *file)
         have_mode = EINA_TRUE;
      }
 
-   EINA_LIST_FOREACH(file->lines, item, line_item)
+   EINA_INARRAY_FOREACH(file->lines, item)
      {
+        line_item = *item;
         if (code && code->config.trim_whitespace &&
             !elm_code_line_contains_widget_cursor(line_item))
           elm_code_line_text_trailing_whitespace_strip(line_item);
@@ -231,14 +233,22 @@ EAPI void elm_code_file_save(Elm_Code_File *file)
      }
 }
 
-EAPI void elm_code_file_free(Elm_Code_File *file)
+static void
+_elm_code_file_lines_free(Elm_Code_File *file)
 {
-   Elm_Code_Line *l;
+   Elm_Code_Line **l;
 
-   EINA_LIST_FREE(file->lines, l)
+   EINA_INARRAY_FOREACH(file->lines, l)
      {
-        elm_code_line_free(l);
+        elm_code_line_free(*l);
      }
+   eina_inarray_flush(file->lines);
+}
+
+EAPI void elm_code_file_free(Elm_Code_File *file)
+{
+   _elm_code_file_lines_free(file);
+   eina_inarray_free(file->lines);
 
    elm_code_file_close(file);
    free(file);
@@ -278,12 +288,7 @@ EAPI const char *elm_code_file_line_ending_chars_get(Elm_Code_File *file, short
 
 EAPI void elm_code_file_clear(Elm_Code_File *file)
 {
-   Elm_Code_Line *l;
-
-   EINA_LIST_FREE(file->lines, l)
-     {
-        elm_code_line_free(l);
-     }
+   _elm_code_file_lines_free(file);
 
    if (file->parent)
      elm_code_callback_fire(file->parent, &ELM_CODE_EVENT_FILE_LOAD_DONE, file);
@@ -291,7 +296,7 @@ EAPI void elm_code_file_clear(Elm_Code_File *file)
 
 EAPI unsigned int elm_code_file_lines_get(Elm_Code_File *file)
 {
-   return eina_list_count(file->lines);
+   return eina_inarray_count(file->lines);
 }
 
 
@@ -303,50 +308,43 @@ EAPI void elm_code_file_line_append(Elm_Code_File *file, const char *line, int l
    _elm_code_file_line_insert_data(file, line, length, row, EINA_FALSE, data);
 }
 
-EAPI void elm_code_file_line_insert(Elm_Code_File *file, unsigned int row, const char *line, int length, void *data)
+static void
+_elm_code_file_lines_renumber(Elm_Code_File *file, unsigned int row)
 {
-   Eina_List *item;
-   Elm_Code_Line *line_item;
-   unsigned int r;
+   Elm_Code_Line **lines;
+   unsigned int i, count;
 
-   _elm_code_file_line_insert_data(file, line, length, row, EINA_FALSE, data);
+   count = eina_inarray_count(file->lines);
+   lines = file->lines->members;
+   for (i = row - 1; i < count; i++)
+     lines[i]->number = i + 1;
+}
 
-   r = row;
-   EINA_LIST_FOREACH(file->lines, item, line_item)
-     {
-        if (line_item->number < row)
-          continue;
+EAPI void elm_code_file_line_insert(Elm_Code_File *file, unsigned int row, const char *line, int length, void *data)
+{
+   _elm_code_file_line_insert_data(file, line, length, row, EINA_FALSE, data);
 
-        line_item->number = r++;
-     }
+   _elm_code_file_lines_renumber(file, row);
 }
 
 EAPI void elm_code_file_line_remove(Elm_Code_File *file, unsigned int row)
 {
-   Eina_List *item, *next;
-   Elm_Code_Line *line_item, *tofree = NULL;
-   unsigned int r;
+   Elm_Code_Line *tofree;
 
-   r = row;
-   EINA_LIST_FOREACH_SAFE(file->lines, item, next, line_item)
-     {
-        if (line_item->number < row)
-          continue;
-        else if (line_item->number == row)
-          {
-             tofree = line_item;
-             file->lines = eina_list_remove_list(file->lines, item);
-             continue;
-          }
+   tofree = elm_code_file_line_get(file, row);
+   if (!tofree)
+     return;
 
-        line_item->number = r++;
-     }
+   eina_inarray_remove_at(file->lines, row - 1);
+   _elm_code_file_lines_renumber(file, row);
 
-   if (tofree)
-     elm_code_line_free(tofree);
+   elm_code_line_free(tofree);
 }
 
 EAPI Elm_Code_Line *elm_code_file_line_get(Elm_Code_File *file, unsigned int number)
 {
-   return eina_list_nth(file->lines, number - 1);
+   if (number < 1 || number > eina_inarray_count(file->lines))
+     return NULL;
+
+   return *(Elm_Code_Line **)eina_inarray_nth(file->lines, number - 1);
 }
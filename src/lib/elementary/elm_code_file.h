@@ -19,7 +19,7 @@ struct _Elm_Code_File
 {
    void *parent;
 
-   Eina_List *lines;
+   Eina_Inarray *lines; /**< Elm_Code_Line pointers, in line number order */
    Eina_File *file;
    void *map;
    const char *mime;
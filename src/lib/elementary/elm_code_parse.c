@@ -55,12 +55,11 @@ _elm_code_parse_file(Elm_Code *code, Elm_Code_File *file)
 void
 _elm_code_parse_reset_file(Elm_Code *code, Elm_Code_File *file)
 {
-   Elm_Code_Line *line;
-   Eina_List *item;
+   Elm_Code_Line **line;
 
-   EINA_LIST_FOREACH(file->lines, item, line)
+   EINA_INARRAY_FOREACH(file->lines, line)
     {
-       _elm_code_parse_line(code, line);
+       _elm_code_parse_line(code, *line);
     }
 }
 
@@ -188,14 +187,14 @@ _elm_code_parser_diff_parse_line(Elm_Code_Line *line, void *data EINA_UNUSED)
 static void
 _elm_code_parser_diff_parse_file(Elm_Code_File *file, void *data EINA_UNUSED)
 {
-   Eina_List *item;
-   Elm_Code_Line *line;
+   Elm_Code_Line **item, *line;
    const char *content;
    unsigned int length, offset;
 
    offset = 0;
-   EINA_LIST_FOREACH(file->lines, item, line)
+   EINA_INARRAY_FOREACH(file->lines, item)
      {
+        line = *item;
         content = elm_code_line_text_get(line, &length);
 
         if (length > 0 && (content[0] == 'd' || content[0] == 'i' || content[0] == 'n'))
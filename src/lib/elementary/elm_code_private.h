@@ -3,6 +3,9 @@
 
 #include "elm_priv.h"
 
+/* Growth step of the line index, big files are opened by thousands of lines */
+#define ELM_CODE_FILE_LINES_STEP 1024
+
 Eina_Bool _elm_code_text_char_is_whitespace(char c);
 
 /* Private parser callbacks */
@@ -2053,7 +2053,7 @@ _elm_code_widget_ensure_n_grid_rows(Elm_Code_Widget *widget, int rows)
 static void
 _elm_code_widget_resize(Elm_Code_Widget *widget, Elm_Code_Line *newline)
 {
-   Eina_List *item, *lines;
+   Eina_List *item;
    Elm_Code_Widget_Data *pd;
    Elm_Code_Line *line;
    Evas_Object *grid;
@@ -2068,7 +2068,7 @@ _elm_code_widget_resize(Elm_Code_Widget *widget, Elm_Code_Line *newline)
    if (!pd->code)
      return;
 
-   if (!pd->code->file->lines)
+   if (!elm_code_file_lines_get(pd->code->file))
      return;
 
    evas_object_geometry_get(widget, NULL, NULL, &ww, &wh);
@@ -2087,17 +2087,14 @@ _elm_code_widget_resize(Elm_Code_Widget *widget, Elm_Code_Line *newline)
 
    /* Calculate the maximum width of our lines. */
 
-   lines = eina_list_nth_list(pd->code->file->lines, first_row - 1);
    for (i = 0; i < n; i++)
      {
-        line = eina_list_data_get(lines);
+        line = elm_code_file_line_get(pd->code->file, first_row + i);
         if (!line) break;
         line_width = elm_code_widget_line_text_column_width_get(widget, line);
 
         if ((int) line_width + gutter + 1 > w)
           w = (int) line_width + gutter + 1;
-
-        lines = eina_list_next(lines);
      }
 
    _elm_code_widget_ensure_n_grid_rows(widget, n);
@@ -133,6 +133,8 @@ static const char SIGNAL_REORDER_MODE_UNSET[] = "elm,state,reorder,mode_unset";
 static const char SIGNAL_CONTRACT_FLIP[] = "elm,state,contract_flip";
 static const char SIGNAL_SHOW[] = "elm,state,show";
 static const char SIGNAL_HIDE[] = "elm,state,hide";
+static const char SIGNAL_CONTENTS_PENDING[] = "elm,state,contents,pending";
+static const char SIGNAL_CONTENTS_READY[] = "elm,state,contents,ready";
 static const char SIGNAL_FLIP_ITEM[] = "elm,action,flip_item";
 static const char SIGNAL_ODD[] = "elm,state,odd";
 static const char SIGNAL_EVEN[] = "elm,state,even";
@@ -1515,16 +1517,29 @@ _contract_signal_cb(void *data,
 }
 
 //-- item cache handle routine --//
+// caches are pooled per item class, so finding a view to reuse only walks
+// the views of the same style
 // push item cache into caches
 static Eina_Bool
 _item_cache_push(Elm_Genlist_Data *sd, Item_Cache *itc)
 {
-   if (!itc || (sd->item_cache_max <= 0))
+   Item_Cache_Pool *pool;
+
+   if (!itc || (sd->item_cache_max <= 0) || (!sd->item_cache_pools))
      return EINA_FALSE;
 
+   pool = eina_hash_find(sd->item_cache_pools, &(itc->item_class));
+   if (!pool)
+     {
+        pool = ELM_NEW(Item_Cache_Pool);
+        if (!pool) return EINA_FALSE;
+        eina_hash_add(sd->item_cache_pools, &(itc->item_class), pool);
+     }
+
+   itc->pool = pool;
+   pool->count++;
+   pool->caches = eina_inlist_prepend(pool->caches, EINA_INLIST_GET(itc));
    sd->item_cache_count++;
-   sd->item_cache =
-     eina_inlist_prepend(sd->item_cache, EINA_INLIST_GET(itc));
 
    return EINA_TRUE;
 }
@@ -1533,17 +1548,34 @@ _item_cache_push(Elm_Genlist_Data *sd, Item_Cache *itc)
 static Item_Cache *
 _item_cache_pop(Elm_Genlist_Data *sd, Item_Cache *itc)
 {
-   if (!itc || (!sd->item_cache) ||
+   if (!itc || (!itc->pool) ||
        (sd->item_cache_count <= 0))
      return NULL;
 
-   sd->item_cache =
-     eina_inlist_remove (sd->item_cache, EINA_INLIST_GET(itc));
+   itc->pool->caches =
+     eina_inlist_remove(itc->pool->caches, EINA_INLIST_GET(itc));
+   itc->pool->count--;
+   itc->pool = NULL;
    sd->item_cache_count--;
 
    return itc;
 }
 
+static Eina_Bool
+_item_cache_pool_largest_cb(const Eina_Hash *hash EINA_UNUSED,
+                            const void *key EINA_UNUSED,
+                            void *data,
+                            void *fdata)
+{
+   Item_Cache_Pool *pool = data, **largest = fdata;
+
+   if ((pool->count > 0) &&
+       ((!*largest) || (pool->count > (*largest)->count)))
+     *largest = pool;
+
+   return EINA_TRUE;
+}
+
 // free one item cache
 static void
 _item_cache_free(Item_Cache *itc)
@@ -1579,10 +1611,19 @@ _item_cache_clean(Elm_Genlist_Data *sd)
    e = evas_object_evas_get(sd->obj);
    evas_event_freeze(e);
 
-   while ((sd->item_cache) && (sd->item_cache_count > sd->item_cache_max))
+   // evict the oldest views of the biggest pool, so one style can not
+   // starve all the others
+   while ((sd->item_cache_pools) &&
+          (sd->item_cache_count > sd->item_cache_max))
      {
-        Item_Cache *itc =
-           EINA_INLIST_CONTAINER_GET(sd->item_cache->last, Item_Cache);
+        Item_Cache_Pool *pool = NULL;
+        Item_Cache *itc;
+
+        eina_hash_foreach(sd->item_cache_pools,
+                          _item_cache_pool_largest_cb, &pool);
+        if (!pool) break;
+
+        itc = EINA_INLIST_CONTAINER_GET(pool->caches->last, Item_Cache);
         _item_cache_free(_item_cache_pop(sd, itc));
      }
    evas_event_thaw(e);
@@ -1598,6 +1639,8 @@ _item_cache_zero(Elm_Genlist_Data *sd)
    sd->item_cache_max = 0;
    _item_cache_clean(sd);
    sd->item_cache_max = pmax;
+   if ((sd->item_cache_pools) && (!sd->item_cache_count))
+     eina_hash_free_buckets(sd->item_cache_pools);
 }
 
 // add an item to item cache
@@ -1679,25 +1722,28 @@ _item_cache_add(Elm_Gen_Item *it, Eina_List *contents)
 }
 
 // find an item from item cache and remove it from the cache
+// the cached contents are only shown back if show is set
 static Eina_Bool
-_item_cache_find(Elm_Gen_Item *it)
+_item_cache_find(Elm_Gen_Item *it, Eina_Bool show)
 {
    if (it->item->nocache_once || it->item->nocache) return EINA_FALSE;
 
    Item_Cache *itc = NULL;
+   Item_Cache_Pool *pool;
    Eina_Inlist *l;
    Eina_Bool tree = 0;
    ELM_GENLIST_DATA_GET_FROM_ITEM(it, sd);
 
+   if (!sd->item_cache_pools) return EINA_FALSE;
+   pool = eina_hash_find(sd->item_cache_pools, &(it->itc));
+   if (!pool) return EINA_FALSE;
+
    if (it->item->type & ELM_GENLIST_ITEM_TREE) tree = 1;
-   EINA_INLIST_FOREACH_SAFE(sd->item_cache, l, itc)
+   EINA_INLIST_FOREACH_SAFE(pool->caches, l, itc)
      {
         Evas_Object *obj;
 
-        if ((itc->tree == tree) &&
-            (((!it->itc) && (!itc->item_class)) ||
-             (it->itc && itc->item_class &&
-              (it->itc == itc->item_class))))
+        if (itc->tree == tree)
           {
              itc = _item_cache_pop(sd, itc);
              if (!itc) continue;
@@ -1711,7 +1757,7 @@ _item_cache_find(Elm_Gen_Item *it)
                {
                   if (elm_widget_is(obj))
                     elm_widget_tree_unfocusable_set(obj, it->item->unfocusable);
-                  evas_object_show(obj);
+                  if (show) evas_object_show(obj);
                }
              itc->contents = NULL;
              _item_cache_free(itc);
@@ -1846,6 +1892,147 @@ _elm_genlist_item_focus_update(Elm_Gen_Item *it)
      }
 }
 
+//-- deferred content realization --//
+// Creating the contents is usually the most expensive part of realizing an
+// item, so when a realize budget is set, items whose size is already known
+// get their texts and states right away and their contents later, a few per
+// frame. Meanwhile the view gets SIGNAL_CONTENTS_PENDING so the theme can
+// show a placeholder.
+static void _item_realize_queue_cb(void *data, const Efl_Event *event);
+
+static void
+_item_realize_queue_stop(Elm_Genlist_Data *sd)
+{
+   if (!sd->realize_animator) return;
+   efl_event_callback_del(sd->obj, EFL_CANVAS_OBJECT_EVENT_ANIMATOR_TICK,
+                          _item_realize_queue_cb, sd->obj);
+   sd->realize_animator = EINA_FALSE;
+}
+
+static Eina_Bool
+_item_content_defer_check(const Elm_Genlist_Data *sd,
+                          const Elm_Gen_Item *it,
+                          Eina_Bool calc)
+{
+   if ((calc) || (sd->realize_budget <= 0.0)) return EINA_FALSE;
+   // the size of the item must not depend on the contents we skip
+   if ((!it->item->mincalcd) || (!it->has_contents)) return EINA_FALSE;
+   if ((it->flipped) || (sd->tree_effect_enabled) ||
+       (sd->reorder_it == it) || (sd->focus_on_realization == it) ||
+       (EO_OBJ(it) == sd->focused_item))
+     return EINA_FALSE;
+   if (_elm_config->access_mode) return EINA_FALSE;
+
+   return EINA_TRUE;
+}
+
+static void
+_item_content_defer(Elm_Genlist_Data *sd, Elm_Gen_Item *it)
+{
+   it->item->content_pending = EINA_TRUE;
+   sd->realize_queue = eina_list_append(sd->realize_queue, it);
+   edje_object_signal_emit(VIEW(it), SIGNAL_CONTENTS_PENDING, "elm");
+
+   if (sd->realize_animator) return;
+   efl_event_callback_add(sd->obj, EFL_CANVAS_OBJECT_EVENT_ANIMATOR_TICK,
+                          _item_realize_queue_cb, sd->obj);
+   sd->realize_animator = EINA_TRUE;
+}
+
+static void
+_item_content_defer_cancel(Elm_Genlist_Data *sd, Elm_Gen_Item *it)
+{
+   Eina_List *source;
+   const char *key;
+
+   if (!it->item->content_pending) return;
+   it->item->content_pending = EINA_FALSE;
+   sd->realize_queue = eina_list_remove(sd->realize_queue, it);
+   if (!sd->realize_queue) _item_realize_queue_stop(sd);
+
+   // contents recycled along with the view are still swallowed, hand them
+   // back so they get cached or deleted with it
+   source = elm_widget_stringlist_get(edje_object_data_get(VIEW(it), "contents"));
+   EINA_LIST_FREE(source, key)
+     {
+        Evas_Object *content = edje_object_part_swallow_get(VIEW(it), key);
+
+        if (content && !eina_list_data_find(it->contents, content))
+          it->contents = eina_list_append(it->contents, content);
+        eina_stringshare_del(key);
+     }
+}
+
+static void
+_item_content_pending_realize(Elm_Gen_Item *it)
+{
+   Evas_Object *content;
+   Eina_List *l;
+
+   it->item->content_pending = EINA_FALSE;
+   _item_content_realize(it, VIEW(it), &it->contents, "contents", NULL,
+                         EINA_FALSE);
+
+   EINA_LIST_FOREACH(it->contents, l, content)
+     {
+        evas_object_show(content);
+        if (((it->item->type == ELM_GENLIST_ITEM_NONE) ||
+             (it->item->type == ELM_GENLIST_ITEM_TREE)) &&
+            elm_widget_is(content) && elm_object_focus_allow_get(content))
+          it->item_focus_chain = eina_list_append
+              (it->item_focus_chain, content);
+     }
+
+   edje_object_signal_emit(VIEW(it), SIGNAL_CONTENTS_READY, "elm");
+   edje_object_message_signal_process(VIEW(it));
+
+   // the size was computed with contents, do it again without them
+   if (!it->contents)
+     {
+        it->has_contents = EINA_FALSE;
+        elm_genlist_item_update(EO_OBJ(it));
+     }
+}
+
+static void
+_item_realize_queue_cb(void *data, const Efl_Event *event EINA_UNUSED)
+{
+   double t0 = ecore_time_get();
+   Elm_Gen_Item *it;
+   Evas *e;
+   ELM_GENLIST_DATA_GET(data, sd);
+
+   e = evas_object_evas_get(sd->obj);
+   evas_event_freeze(e);
+
+   // always realize at least one item per frame, so the queue drains even
+   // with contents that are more expensive than the whole budget
+   while (sd->realize_queue)
+     {
+        it = eina_list_data_get(sd->realize_queue);
+        sd->realize_queue =
+          eina_list_remove_list(sd->realize_queue, sd->realize_queue);
+        _item_content_pending_realize(it);
+
+        if ((ecore_time_get() - t0) >= sd->realize_budget) break;
+     }
+
+   evas_event_thaw(e);
+   evas_event_thaw_eval(e);
+
+   if (!sd->realize_queue) _item_realize_queue_stop(sd);
+}
+
+static void
+_item_realize_queue_flush(Elm_Genlist_Data *sd)
+{
+   Elm_Gen_Item *it;
+
+   _item_realize_queue_stop(sd);
+   EINA_LIST_FREE(sd->realize_queue, it)
+     _item_content_pending_realize(it);
+}
+
 static void
 _item_realize(Elm_Gen_Item *it, const int index, Eina_Bool calc)
 {
@@ -1853,6 +2040,7 @@ _item_realize(Elm_Gen_Item *it, const int index, Eina_Bool calc)
    Item_Size *size = NULL;
    int tsize = 20;
    int in = index;
+   Eina_Bool defer;
    ELM_GENLIST_DATA_GET_FROM_ITEM(it, sd);
 
    if (it->realized)
@@ -1865,8 +2053,9 @@ _item_realize(Elm_Gen_Item *it, const int index, Eina_Bool calc)
         return;
      }
 
+   defer = _item_content_defer_check(sd, it, calc);
    if (sd->tree_effect_enabled ||
-       (!_item_cache_find(it)))
+       (!_item_cache_find(it, !defer)))
      {
         VIEW_SET(it, _view_create(it, it->itc->item_style));
         if (it->item->nocache_once)
@@ -1949,10 +2138,18 @@ _item_realize(Elm_Gen_Item *it, const int index, Eina_Bool calc)
           ERR_ABORT("If you see this error, please notify us and we"
                     "will fix it");
 
-        _view_inflate(VIEW(it), it, &it->texts, &it->contents, calc);
-        if (it->has_contents != (!!it->contents))
-          it->item->mincalcd = EINA_FALSE;
-        it->has_contents = !!it->contents;
+        if (defer)
+          {
+             _view_inflate(VIEW(it), it, &it->texts, NULL, calc);
+             _item_content_defer(sd, it);
+          }
+        else
+          {
+             _view_inflate(VIEW(it), it, &it->texts, &it->contents, calc);
+             if (it->has_contents != (!!it->contents))
+               it->item->mincalcd = EINA_FALSE;
+             it->has_contents = !!it->contents;
+          }
         if (it->flipped)
           {
              edje_object_signal_emit(VIEW(it), SIGNAL_FLIP_ENABLED, "elm");
@@ -5380,6 +5577,8 @@ _item_unrealize(Elm_Gen_Item *it)
    Evas_Object *c;
    Eina_List *cache = NULL;
 
+   _item_content_defer_cancel(it->item->wsd, it);
+
    EINA_LIST_FREE(it->item->flip_contents, c)
      evas_object_del(c);
 
@@ -5824,6 +6023,7 @@ _elm_genlist_efl_canvas_group_group_add(Eo *obj, Elm_Genlist_Data *priv)
    efl_canvas_group_add(efl_super(obj, MY_CLASS));
 
    priv->size_caches = eina_hash_pointer_new(_size_cache_free);
+   priv->item_cache_pools = eina_hash_pointer_new(free);
    priv->hit_rect = evas_object_rectangle_add(e);
    evas_object_smart_member_add(priv->hit_rect, obj);
    elm_widget_sub_object_add(obj, priv->hit_rect);
@@ -5922,6 +6122,9 @@ _elm_genlist_efl_canvas_group_group_del(Eo *obj, Elm_Genlist_Data *sd)
    ELM_SAFE_FREE(sd->must_recalc_idler, ecore_idler_del);
    ELM_SAFE_FREE(sd->multi_timer, ecore_timer_del);
    ELM_SAFE_FREE(sd->size_caches, eina_hash_free);
+   _item_realize_queue_stop(sd);
+   sd->realize_queue = eina_list_free(sd->realize_queue);
+   ELM_SAFE_FREE(sd->item_cache_pools, eina_hash_free);
 
    eina_stringshare_replace(&sd->decorate_it_type, NULL);
 
@@ -7462,7 +7665,9 @@ _elm_genlist_item_fields_update(Eo *eo_item EINA_UNUSED, Elm_Gen_Item *it,
      {
         _item_text_realize(it, VIEW(it), &it->texts, parts);
      }
-   if ((!itf) || (itf & ELM_GENLIST_ITEM_FIELD_CONTENT))
+   // pending contents are all created by the realize queue anyway
+   if (((!itf) || (itf & ELM_GENLIST_ITEM_FIELD_CONTENT)) &&
+       (!it->item->content_pending))
      {
         _item_content_realize(it, VIEW(it), &it->contents, "contents", parts, EINA_FALSE);
         if (it->flipped)
@@ -8662,6 +8867,26 @@ _elm_genlist_focus_on_selection_get(const Eo *obj EINA_UNUSED, Elm_Genlist_Data
    return sd->focus_on_selection_enabled;
 }
 
+EAPI void
+elm_genlist_realize_budget_set(Evas_Object *obj, double budget)
+{
+   ELM_GENLIST_CHECK(obj);
+   ELM_GENLIST_DATA_GET(obj, sd);
+
+   if (budget < 0.0) budget = 0.0;
+   sd->realize_budget = budget;
+   if (budget <= 0.0) _item_realize_queue_flush(sd);
+}
+
+EAPI double
+elm_genlist_realize_budget_get(const Evas_Object *obj)
+{
+   ELM_GENLIST_CHECK(obj) 0.0;
+   ELM_GENLIST_DATA_GET(obj, sd);
+
+   return sd->realize_budget;
+}
+
 EAPI Elm_Object_Item *
 elm_genlist_nth_item_get(const Evas_Object *obj, unsigned int nth)
 {
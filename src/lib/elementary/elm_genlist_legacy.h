@@ -31,5 +31,45 @@ EAPI Evas_Object                  *elm_genlist_add(Evas_Object *parent);
 EAPI Elm_Object_Item *
 elm_genlist_nth_item_get(const Evas_Object *obj, unsigned int nth);
 
+/**
+ * Set the time the genlist may spend per frame creating item contents
+ *
+ * @param obj The genlist object
+ * @param budget The time in seconds, @c 0 to disable
+ *
+ * When set, items scrolled into view whose size is already known get their
+ * texts and states right away, while their contents (the content_get and
+ * reusable_content_get calls of the item class) are created later, a few
+ * items per frame until @p budget is used up. Until then the item view gets
+ * the "elm,state,contents,pending" signal, and "elm,state,contents,ready"
+ * once its contents are in place, so the theme can show a placeholder.
+ *
+ * This keeps fast scrolling smooth with expensive contents, but content_get
+ * may then be called some frames after the item got realized, or not at
+ * all if it leaves the viewport again before that.
+ *
+ * Setting it back to @c 0 creates all pending contents right away. It is
+ * disabled by default.
+ *
+ * @see elm_genlist_realize_budget_get()
+ *
+ * @ingroup Elm_Genlist_Group
+ * @since 1.29
+ */
+EAPI void elm_genlist_realize_budget_set(Evas_Object *obj, double budget);
+
+/**
+ * Get the time the genlist may spend per frame creating item contents
+ *
+ * @param obj The genlist object
+ * @return The time in seconds, @c 0 if contents are created right away
+ *
+ * @see elm_genlist_realize_budget_set()
+ *
+ * @ingroup Elm_Genlist_Group
+ * @since 1.29
+ */
+EAPI double elm_genlist_realize_budget_get(const Evas_Object *obj);
+
 #include "elm_genlist_item_eo.legacy.h"
 #include "elm_genlist_eo.legacy.h"
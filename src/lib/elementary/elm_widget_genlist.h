@@ -83,9 +83,10 @@ struct _Elm_Genlist_Data
    Eina_List                            *queue;
    Elm_Gen_Item                         *show_item, *anchor_item, *mode_item,
                                         *reorder_rel, *expanded_item, *pin_item;
-   Eina_Inlist                          *item_cache; /* an inlist of
-                                                      * edje object it
-                                                      * cache. */
+   Eina_Hash                            *item_cache_pools; /* item class ->
+                                                            * Item_Cache_Pool
+                                                            * of cached edje
+                                                            * objects. */
    Evas_Coord                            anchor_y;
    Evas_Coord                            reorder_start_y; /* reorder
                                                            * it's
@@ -143,6 +144,14 @@ struct _Elm_Genlist_Data
    Eina_Hash                             *size_caches;
 
    Eina_Hash                            *content_item_map;
+   Eina_List                            *realize_queue; /* items waiting
+                                                         * for their
+                                                         * contents. */
+   double                                realize_budget; /* time per frame
+                                                          * spent on queued
+                                                          * contents, 0 to
+                                                          * realize them
+                                                          * right away. */
    Eo                                   *provider;
    Elm_Gen_Item                         *focus_on_realization;
 
@@ -206,10 +215,12 @@ struct _Elm_Genlist_Data
    Eina_Bool                             tree_effect_animator : 1;
    Eina_Bool                             pin_item_top : 1;
    Eina_Bool                             need_calc : 1; /* _calc_job() must be called in group_calc */
+   Eina_Bool                             realize_animator : 1;
 };
 
 typedef struct _Item_Block Item_Block;
 typedef struct _Item_Cache Item_Cache;
+typedef struct _Item_Cache_Pool Item_Cache_Pool;
 typedef struct _Item_Size Item_Size;
 
 struct Elm_Gen_Item_Type
@@ -254,6 +265,8 @@ struct Elm_Gen_Item_Type
    Eina_Bool               before : 1;
    Eina_Bool               show_me : 1;
    Eina_Bool               unfocusable : 1; /* item is not focusable; propagate to content */
+   Eina_Bool               content_pending : 1; /* contents are waiting in
+                                                 * the realize queue */
 };
 
 struct _Item_Block
@@ -284,12 +297,19 @@ struct _Item_Cache
 {
    EINA_INLIST;
 
+   Item_Cache_Pool *pool;
    Evas_Object *base_view, *spacer;
    const Elm_Genlist_Item_Class  *item_class; // it->itc
    Eina_Bool    tree : 1; // it->group
    Eina_List   *contents; // content objects for reusing
 };
 
+struct _Item_Cache_Pool
+{
+   Eina_Inlist *caches; // most recently cached first
+   int          count;
+};
+
 struct _Item_Size
 {
    const Elm_Genlist_Item_Class *itc;
@@ -27,6 +27,7 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#include <limits.h>
 
 #include <Eina.h>
 
@@ -758,10 +759,18 @@ embryo_program_recursion_get(Embryo_Program *ep)
 
 /* jump table optimization - only works for gcc though */
 #ifdef EMBRYO_EXEC_JUMPTABLE
+/* every handler dispatches the next instruction itself (threaded code),
+ * so the indirect jumps are spread over the handlers and predicted per
+ * opcode. only when the cycle budget runs out do we fall back to the
+ * loop head, which decides if the run has to stop */
 #define SWITCH(x) while (1) { goto *switchtable[x];
 #define SWITCHEND break; }
 #define CASE(x)   SWITCHTABLE_##x :
-#define BREAK     break;
+#define BREAK \
+   if (cycles_left <= 0) break; \
+   cycles_left--; \
+   op = (Embryo_Opcode) * cip++; \
+   goto *switchtable[op]
 #else
 #define SWITCH(x) switch (x) {
 #define SWITCHEND }
@@ -784,7 +793,7 @@ embryo_program_run(Embryo_Program *ep, Embryo_Function fn)
    Embryo_Cell offs;
    int num;
    int max_run_cycles;
-   int cycle_count;
+   int cycles_left;
 #ifdef EMBRYO_EXEC_JUMPTABLE
    /* we limit the jumptable to 256 elements. why? above we forced "op" to be
     * a unsigned char - that means 256 max values. we limit opcode overflow
@@ -1105,17 +1114,21 @@ embryo_program_run(Embryo_Program *ep, Embryo_Function fn)
    ep->run_count++;
 
    max_run_cycles = ep->max_run_cycles;
+   /* instructions left to run, an unlimited run just gets a new budget
+    * whenever it is used up */
+   cycles_left = (max_run_cycles > 0) ? max_run_cycles : INT_MAX;
    /* start running */
-   for (cycle_count = 0;; )
+   for (;; )
      {
-        if (max_run_cycles > 0)
+        if (cycles_left <= 0)
           {
-             if (cycle_count >= max_run_cycles)
+             if (max_run_cycles > 0)
                {
                   TOOLONG(ep);
                }
-             cycle_count++;
+             cycles_left = INT_MAX;
           }
+        cycles_left--;
         op = (Embryo_Opcode) * cip++;
         SWITCH(op);
         CASE(EMBRYO_OP_LOAD_PRI);
@@ -243,6 +243,7 @@ _efl_canvas_event_grabber_efl_canvas_group_group_member_add(Eo *eo_obj, Efl_Obje
    EINA_COW_WRITE_BEGIN(evas_object_events_cow, sub->events, Evas_Object_Events_Data, events)
      events->parent = eo_obj;
    EINA_COW_WRITE_END(evas_object_events_cow, sub->events, events);
+   if (sub->layer) evas_event_index_invalidate(sub->layer->evas);
    _child_insert(pd, sub);
    efl_event_callback_add(eo_sub, EFL_EVENT_INVALIDATE, _efl_canvas_object_event_grabber_child_invalidate, pd);
    if (eo_sub != pd->rect)
@@ -261,6 +262,7 @@ _efl_canvas_event_grabber_efl_canvas_group_group_member_remove(Eo *eo_obj EINA_U
    EINA_COW_WRITE_BEGIN(evas_object_events_cow, obj->events, Evas_Object_Events_Data, events)
      events->parent = NULL;
    EINA_COW_WRITE_END(evas_object_events_cow, obj->events, events);
+   if (obj->layer) evas_event_index_invalidate(obj->layer->evas);
 }
 
 EOLIAN static void
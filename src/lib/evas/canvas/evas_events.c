@@ -379,6 +379,266 @@ _evas_event_object_list_raw_in_get_single(Evas *eo_e, Evas_Object_Protected_Data
    return in;
 }
 
+/* Long object lists (layers, smart objects with lots of members) get a
+ * coarse grid of the clipped object areas, so a hit test only has to look
+ * at the objects in one cell instead of walking the whole list. The grids
+ * are built on demand and all dropped on the next object change.
+ */
+#define EVENT_INDEX_MIN 32
+#define EVENT_INDEX_GRID_MAX 32
+
+typedef struct _Evas_Event_Index Evas_Event_Index;
+
+struct _Evas_Event_Index
+{
+   Evas_Object_Protected_Data **objs; // top to bottom, NULL: short list
+   int *cells; // object indexes, grouped by cell, in objs order
+   int *cells_start; // gw * gh + 1 offsets into cells
+   int *always; // objects to check wherever the point is
+   int always_num;
+   int x, y, w, h;
+   int cw, ch, gw, gh;
+};
+
+typedef enum
+{
+   EVENT_INDEX_NONE,
+   EVENT_INDEX_GRID,
+   EVENT_INDEX_ALWAYS
+} Evas_Event_Index_Kind;
+
+void
+evas_event_index_invalidate(Evas_Public_Data *e)
+{
+   if (e) e->event_index_valid = EINA_FALSE;
+}
+
+static void
+_evas_event_index_free(void *data)
+{
+   Evas_Event_Index *idx = data;
+
+   free(idx->objs);
+   free(idx->cells);
+   free(idx->cells_start);
+   free(idx->always);
+   free(idx);
+}
+
+static Evas_Event_Index_Kind
+_evas_event_index_rect_get(Evas_Object_Protected_Data *obj, Eina_Rectangle *c)
+{
+   // the area _evas_event_object_list_raw_in_get_single() tests against
+   if ((!obj->cur->visible) && (!obj->is_event_parent)) return EVENT_INDEX_NONE;
+   if ((obj->child_has_map) || (_evas_render_has_map(obj)))
+     return EVENT_INDEX_ALWAYS;
+   if (obj->is_smart)
+     {
+        Eina_Rectangle bounding_box = { 0, };
+
+        evas_object_smart_bounding_box_update(obj);
+        evas_object_smart_bounding_box_get(obj, &bounding_box, NULL);
+        *c = bounding_box;
+     }
+   else
+     {
+        if (obj->clip.clipees) return EVENT_INDEX_NONE;
+        *c = obj->cur->geometry;
+     }
+   clip_calc(obj->cur->clipper, c);
+   if ((c->w <= 0) || (c->h <= 0)) return EVENT_INDEX_NONE;
+   return EVENT_INDEX_GRID;
+}
+
+static void
+_evas_event_index_cells_get(const Evas_Event_Index *idx, const Eina_Rectangle *r,
+                            int *x1, int *y1, int *x2, int *y2)
+{
+   *x1 = (r->x - idx->x) / idx->cw;
+   *y1 = (r->y - idx->y) / idx->ch;
+   *x2 = (r->x + r->w - 1 - idx->x) / idx->cw;
+   *y2 = (r->y + r->h - 1 - idx->y) / idx->ch;
+}
+
+static Evas_Event_Index *
+_evas_event_index_build(const Eina_Inlist *ilist)
+{
+   Evas_Event_Index *idx;
+   Evas_Object_Protected_Data *obj;
+   Eina_Rectangle *rects = NULL;
+   unsigned char *kinds = NULL;
+   int num = 0, grid_num = 0, cells, i, j, k, x1, y1, x2, y2;
+   int bx1 = 0, by1 = 0, bx2 = 0, by2 = 0;
+
+   idx = calloc(1, sizeof(Evas_Event_Index));
+   if (!idx) return NULL;
+
+   EINA_INLIST_FOREACH(ilist, obj)
+     if (!obj->events->parent) num++;
+   if (num < EVENT_INDEX_MIN) return idx;
+
+   idx->objs = malloc(num * sizeof(Evas_Object_Protected_Data *));
+   idx->always = malloc(num * sizeof(int));
+   rects = malloc(num * sizeof(Eina_Rectangle));
+   kinds = malloc(num);
+   if ((!idx->objs) || (!idx->always) || (!rects) || (!kinds)) goto err;
+
+   i = 0;
+   EINA_INLIST_REVERSE_FOREACH(ilist, obj)
+     {
+        if (obj->events->parent) continue;
+        idx->objs[i] = obj;
+        kinds[i] = _evas_event_index_rect_get(obj, &rects[i]);
+        if (kinds[i] == EVENT_INDEX_GRID)
+          {
+             if ((!grid_num) || (rects[i].x < bx1)) bx1 = rects[i].x;
+             if ((!grid_num) || (rects[i].y < by1)) by1 = rects[i].y;
+             if ((!grid_num) || (rects[i].x + rects[i].w > bx2))
+               bx2 = rects[i].x + rects[i].w;
+             if ((!grid_num) || (rects[i].y + rects[i].h > by2))
+               by2 = rects[i].y + rects[i].h;
+             grid_num++;
+          }
+        i++;
+     }
+
+   // aim at a handful of objects per cell
+   idx->gw = 1;
+   while ((idx->gw < EVENT_INDEX_GRID_MAX) &&
+          (((idx->gw + 1) * (idx->gw + 1) * 4) <= grid_num))
+     idx->gw++;
+   idx->gh = idx->gw;
+   idx->x = bx1;
+   idx->y = by1;
+   idx->w = bx2 - bx1;
+   idx->h = by2 - by1;
+   idx->cw = (idx->w + idx->gw - 1) / idx->gw;
+   idx->ch = (idx->h + idx->gh - 1) / idx->gh;
+   if (idx->cw < 1) idx->cw = 1;
+   if (idx->ch < 1) idx->ch = 1;
+   cells = idx->gw * idx->gh;
+
+   idx->cells_start = calloc(cells + 1, sizeof(int));
+   if (!idx->cells_start) goto err;
+
+   // count the objects of each cell first. objects spread over a big part
+   // of the grid (backgrounds and such) are simply checked everywhere
+   for (i = 0; i < num; i++)
+     {
+        if (kinds[i] == EVENT_INDEX_GRID)
+          {
+             _evas_event_index_cells_get(idx, &rects[i], &x1, &y1, &x2, &y2);
+             if ((cells >= 16) &&
+                 (((x2 - x1 + 1) * (y2 - y1 + 1)) > (cells / 4)))
+               kinds[i] = EVENT_INDEX_ALWAYS;
+             else
+               {
+                  for (k = y1; k <= y2; k++)
+                    for (j = x1; j <= x2; j++)
+                      idx->cells_start[(k * idx->gw) + j + 1]++;
+               }
+          }
+        if (kinds[i] == EVENT_INDEX_ALWAYS)
+          idx->always[idx->always_num++] = i;
+     }
+   for (i = 0; i < cells; i++)
+     idx->cells_start[i + 1] += idx->cells_start[i];
+
+   idx->cells = malloc((idx->cells_start[cells] + 1) * sizeof(int));
+   if (!idx->cells) goto err;
+
+   // going top to bottom keeps every cell in stacking order
+   for (i = 0; i < num; i++)
+     {
+        if (kinds[i] != EVENT_INDEX_GRID) continue;
+        _evas_event_index_cells_get(idx, &rects[i], &x1, &y1, &x2, &y2);
+        for (k = y1; k <= y2; k++)
+          for (j = x1; j <= x2; j++)
+            idx->cells[idx->cells_start[(k * idx->gw) + j]++] = i;
+     }
+   // filling moved each start up to the next one, move them back
+   for (i = cells; i > 0; i--)
+     idx->cells_start[i] = idx->cells_start[i - 1];
+   idx->cells_start[0] = 0;
+
+   free(rects);
+   free(kinds);
+   return idx;
+
+err:
+   free(rects);
+   free(kinds);
+   _evas_event_index_free(idx);
+   return NULL;
+}
+
+static Evas_Event_Index *
+_evas_event_index_get(Evas_Public_Data *e, const Eina_Inlist *ilist)
+{
+   Evas_Event_Index *idx;
+
+   if (!e->event_index_valid)
+     {
+        // never free an index from under someone walking it, the list
+        // is simply walked until it is safe to rebuild
+        if (e->event_index_walking) return NULL;
+        if (e->event_index) eina_hash_free_buckets(e->event_index);
+        e->event_index_valid = EINA_TRUE;
+     }
+   if (!e->event_index)
+     {
+        e->event_index = eina_hash_pointer_new(_evas_event_index_free);
+        if (!e->event_index) return NULL;
+     }
+
+   idx = eina_hash_find(e->event_index, &ilist);
+   if (!idx)
+     {
+        idx = _evas_event_index_build(ilist);
+        if (!idx) return NULL;
+        if (!eina_hash_add(e->event_index, &ilist, idx))
+          {
+             _evas_event_index_free(idx);
+             return NULL;
+          }
+     }
+   if (!idx->objs) return NULL;
+   return idx;
+}
+
+static Eina_List *
+_evas_event_index_in_get(Evas *eo_e, Evas_Public_Data *e, Evas_Event_Index *idx,
+                         Eina_List *in, int x, int y, int *no_rep,
+                         int spaces)
+{
+   Evas_Object_Protected_Data *obj;
+   const int *cell = NULL, *cell_end = NULL;
+   const int *al = idx->always, *al_end = idx->always + idx->always_num;
+   int c;
+
+   if (RECTS_INTERSECT(x, y, 1, 1, idx->x, idx->y, idx->w, idx->h))
+     {
+        c = (((y - idx->y) / idx->ch) * idx->gw) + ((x - idx->x) / idx->cw);
+        cell = idx->cells + idx->cells_start[c];
+        cell_end = idx->cells + idx->cells_start[c + 1];
+     }
+
+   e->event_index_walking++;
+   // merge the cell with the objects checked everywhere, top first
+   while ((cell < cell_end) || (al < al_end))
+     {
+        if ((al == al_end) || ((cell < cell_end) && (*cell < *al)))
+          obj = idx->objs[*(cell++)];
+        else
+          obj = idx->objs[*(al++)];
+        if (obj->events->parent) continue;
+        in = _evas_event_object_list_raw_in_get_single(eo_e, obj, in, NULL, x, y, no_rep, EINA_FALSE, spaces);
+        if (*no_rep) break;
+     }
+   e->event_index_walking--;
+   return in;
+}
+
 static Eina_List *
 _evas_event_object_list_raw_in_get(Evas *eo_e, Eina_List *in,
                                    const Eina_Inlist *ilist,
@@ -395,18 +655,35 @@ _evas_event_object_list_raw_in_get(Evas *eo_e, Eina_List *in,
    spaces++;
    if (ilist)
      {
+        Evas_Public_Data *e = NULL;
+        Evas_Event_Index *idx = NULL;
         Eina_Inlist *last;
 
-        if (must_walk_last) last = eina_inlist_last(ilist);
-        else last = ilist->last;
-        for (obj = _EINA_INLIST_CONTAINER(obj, last);
-             obj;
-             obj = _EINA_INLIST_CONTAINER(obj, EINA_INLIST_GET(obj)->prev))
+        // the index covers whole lists and knows nothing of stop objects,
+        // and it leaves out what source lookups ignore: visibility and clips
+        if ((!must_walk_last) && (!stop) && (!source))
           {
-             if (obj->events->parent) continue;
-             in = _evas_event_object_list_raw_in_get_single(eo_e, obj, in, stop, x, y, no_rep, source, spaces);
+             e = efl_data_scope_get(eo_e, EVAS_CANVAS_CLASS);
+             idx = _evas_event_index_get(e, ilist);
+          }
+        if (idx)
+          {
+             in = _evas_event_index_in_get(eo_e, e, idx, in, x, y, no_rep, spaces);
              if (*no_rep) goto end;
           }
+        else
+          {
+             if (must_walk_last) last = eina_inlist_last(ilist);
+             else last = ilist->last;
+             for (obj = _EINA_INLIST_CONTAINER(obj, last);
+                  obj;
+                  obj = _EINA_INLIST_CONTAINER(obj, EINA_INLIST_GET(obj)->prev))
+               {
+                  if (obj->events->parent) continue;
+                  in = _evas_event_object_list_raw_in_get_single(eo_e, obj, in, stop, x, y, no_rep, source, spaces);
+                  if (*no_rep) goto end;
+               }
+          }
      }
    else
      {
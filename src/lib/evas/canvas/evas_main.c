@@ -649,6 +649,7 @@ _evas_canvas_efl_object_destructor(Eo *eo_e, Evas_Public_Data *e)
    eina_array_flush(&e->texts_unref_queue);
    eina_array_flush(&e->map_clip_objects);
    eina_hash_free(e->focused_objects);
+   if (e->event_index) eina_hash_free(e->event_index);
    eina_array_flush(&e->render_post_change_objects);
 
    SLKL(e->post_render.lock);
@@ -540,6 +540,7 @@ evas_object_change(Evas_Object *eo_obj EINA_UNUSED, Evas_Object_Protected_Data *
    Eina_Bool movch = EINA_FALSE;
 
    if ((!obj->layer) || (!obj->layer->evas)) return;
+   evas_event_index_invalidate(obj->layer->evas);
    if (obj->layer->evas->nochange) return;
    obj->layer->evas->changed = EINA_TRUE;
 
@@ -293,6 +293,7 @@ _efl_canvas_group_group_member_add(Eo *smart_obj, Evas_Smart_Data *o, Evas_Objec
    obj->smart.parent_data = o;
    obj->smart.parent_object_data = smart;
    o->contained = eina_inlist_append(o->contained, EINA_INLIST_GET(obj));
+   if (obj->layer) evas_event_index_invalidate(obj->layer->evas);
 
    if (obj->is_smart) member_o = efl_data_scope_get(eo_obj, MY_CLASS);
    _evas_object_smart_member_cache_invalidate(obj, member_o);
@@ -385,6 +386,7 @@ _efl_canvas_group_group_member_remove(Eo *smart_obj, Evas_Smart_Data *sd, Evas_O
 
    o->contained = eina_inlist_remove(o->contained, EINA_INLIST_GET(obj));
    o->member_count--;
+   if (obj->layer) evas_event_index_invalidate(obj->layer->evas);
    obj->smart.parent = NULL;
 
    if (obj->is_smart) member_o = efl_data_scope_get(eo_obj, MY_CLASS);
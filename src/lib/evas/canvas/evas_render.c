@@ -98,6 +98,7 @@ rend_dbg(const char *txt)
 #define ENC _evas_engine_context(evas)
 
 typedef struct _Render_Updates Render_Updates;
+typedef struct _Render_Scroll  Render_Scroll;
 typedef struct _Cutout_Margin  Cutout_Margin;
 
 struct _Render_Updates
@@ -106,6 +107,15 @@ struct _Render_Updates
    Eina_Rectangle *area;
 };
 
+#define RENDER_SCROLL_MAX 8
+
+struct _Render_Scroll
+{
+   Evas_Object_Protected_Data *clipper;
+   int dx, dy;
+   Eina_Bool ok : 1;
+};
+
 struct _Cutout_Margin
 {
    int l, r, t, b;
@@ -439,6 +449,216 @@ _evas_render_object_is_mask(Evas_Object_Protected_Data *obj)
    return EINA_FALSE;
 }
 
+/* When all a clipper shows this frame is the same content it showed last
+ * frame, just moved by some amount (a scroller panning), the engine can move
+ * the pixels it already has instead of drawing them all again. */
+
+extern const char *o_rect_type;
+
+static Eina_Bool
+_evas_render_object_moved_get(Evas_Object_Protected_Data *obj, int *dx, int *dy)
+{
+   // need_surface_clear is set by any change that is not a move
+   if ((!obj->changed) || (obj->need_surface_clear) || (obj->restack) ||
+       (obj->delete_me))
+     return EINA_FALSE;
+   if ((obj->cur->clipper != obj->prev->clipper) ||
+       (obj->cur->geometry.w != obj->prev->geometry.w) ||
+       (obj->cur->geometry.h != obj->prev->geometry.h))
+     return EINA_FALSE;
+   *dx = obj->cur->geometry.x - obj->prev->geometry.x;
+   *dy = obj->cur->geometry.y - obj->prev->geometry.y;
+   return EINA_TRUE;
+}
+
+/* the first clipper up the chain that stayed put, if all the ones in between
+ * moved along with obj */
+static Evas_Object_Protected_Data *
+_evas_render_scroll_clipper_get(Evas_Object_Protected_Data *obj, int dx, int dy)
+{
+   Evas_Object_Protected_Data *clip;
+   int cdx, cdy;
+
+   for (clip = obj->cur->clipper; clip; clip = clip->cur->clipper)
+     {
+        if (!clip->changed)
+          {
+             if ((clip->mask->is_mask) || (_evas_render_has_map(clip)) ||
+                 (!clip->cur->cache.clip.visible))
+               return NULL;
+             return clip;
+          }
+        if ((!_evas_render_object_moved_get(clip, &cdx, &cdy)) ||
+            (cdx != dx) || (cdy != dy))
+          return NULL;
+     }
+   return NULL;
+}
+
+/* is obj drawn where it is, as it is */
+static Eina_Bool
+_evas_render_scroll_plain_get(Evas_Object_Protected_Data *obj)
+{
+   Evas_Object_Protected_Data *parent;
+
+   if ((obj->clip.mask) || (obj->cur->snapshot) ||
+       (_evas_render_has_map(obj)) || (_evas_render_had_map(obj)) ||
+       (evas_object_is_on_plane(obj)))
+     return EINA_FALSE;
+   for (parent = obj->smart.parent_object_data; parent;
+        parent = parent->smart.parent_object_data)
+     {
+        if ((_evas_render_has_map(parent)) || (_evas_render_had_map(parent)))
+          return EINA_FALSE;
+     }
+   return EINA_TRUE;
+}
+
+static Eina_Bool
+_evas_render_scroll_check(Evas_Public_Data *e, Evas_Object_Protected_Data *clip,
+                          int dx, int dy)
+{
+   Evas_Object_Protected_Data *obj, *c;
+   Eina_Rectangle *r;
+   Eina_List *l;
+   Eina_Bool found = EINA_FALSE;
+   int x, y, w, h, odx, ody;
+   unsigned int i;
+
+   x = clip->cur->cache.clip.x;
+   y = clip->cur->cache.clip.y;
+   w = clip->cur->cache.clip.w;
+   h = clip->cur->cache.clip.h;
+   if ((w <= abs(dx)) || (h <= abs(dy))) return EINA_FALSE;
+
+   // moving pixels would also write inside areas we must not draw on
+   EINA_LIST_FOREACH(e->obscures, l, r)
+     {
+        if (RECTS_INTERSECT(r->x, r->y, r->w, r->h, x, y, w, h))
+          return EINA_FALSE;
+     }
+
+   for (i = 0; i < e->active_objects.len; i++)
+     {
+        Evas_Active_Entry *ent = eina_inarray_nth(&e->active_objects, i);
+
+        obj = ent->obj;
+        if ((obj->is_smart) || (obj == clip)) continue;
+        if ((!evas_object_is_visible(obj)) && (!evas_object_was_visible(obj)))
+          continue;
+        if ((!RECTS_INTERSECT(obj->cur->cache.clip.x, obj->cur->cache.clip.y,
+                              obj->cur->cache.clip.w, obj->cur->cache.clip.h,
+                              x, y, w, h)) &&
+            (!RECTS_INTERSECT(obj->prev->cache.clip.x, obj->prev->cache.clip.y,
+                              obj->prev->cache.clip.w, obj->prev->cache.clip.h,
+                              x, y, w, h)))
+          continue;
+        if (obj->clip.clipees)
+          {
+             // clippers are not drawn, image masks are though
+             if ((_evas_render_object_is_mask(obj)) && (obj->changed))
+               return EINA_FALSE;
+             continue;
+          }
+
+        for (c = obj->cur->clipper; c && (c != clip); c = c->cur->clipper);
+        if (c)
+          {
+             if ((!_evas_render_object_moved_get(obj, &odx, &ody)) ||
+                 (odx != dx) || (ody != dy) ||
+                 (!_evas_render_scroll_plain_get(obj)) ||
+                 (_evas_render_scroll_clipper_get(obj, dx, dy) != clip))
+               return EINA_FALSE;
+             found = EINA_TRUE;
+          }
+        else
+          {
+             /* what does not move along must look the same all over the
+              * area (a plain background) and be below what moves */
+             if ((found) || (obj->changed) || (obj->type != o_rect_type) ||
+                 (!_evas_render_scroll_plain_get(obj)) ||
+                 (obj->cur->cache.clip.x > x) ||
+                 (obj->cur->cache.clip.y > y) ||
+                 ((obj->cur->cache.clip.x + obj->cur->cache.clip.w) < (x + w)) ||
+                 ((obj->cur->cache.clip.y + obj->cur->cache.clip.h) < (y + h)))
+               return EINA_FALSE;
+          }
+     }
+   return found;
+}
+
+static int
+_evas_render_scrolls_find(Evas_Public_Data *e, Render_Scroll *scrolls)
+{
+   Evas_Object_Protected_Data *obj, *clip;
+   unsigned int i;
+   int j, num = 0, dx, dy;
+
+   for (i = 0; i < e->render_objects.count; i++)
+     {
+        obj = eina_array_data_get(&e->render_objects, i);
+        if ((obj->is_smart) || (obj->clip.clipees)) continue;
+        if ((!_evas_render_object_moved_get(obj, &dx, &dy)) ||
+            ((!dx) && (!dy)))
+          continue;
+        clip = _evas_render_scroll_clipper_get(obj, dx, dy);
+        if (!clip) continue;
+        for (j = 0; j < num; j++)
+          {
+             if (scrolls[j].clipper == clip) break;
+          }
+        if (j < num) continue;
+        if (num >= RENDER_SCROLL_MAX) break;
+        scrolls[num].clipper = clip;
+        scrolls[num].dx = dx;
+        scrolls[num].dy = dy;
+        scrolls[num].ok = _evas_render_scroll_check(e, clip, dx, dy);
+        RD(0, "  scroll %s by %i,%i: %i\n", RDNAME(clip), dx, dy, scrolls[num].ok);
+        num++;
+     }
+   return num;
+}
+
+static Eina_Bool
+_evas_render_scrolls_output_add(Evas_Public_Data *evas, Efl_Canvas_Output *out,
+                                Render_Scroll *scrolls, int num,
+                                Eina_Bool make_updates)
+{
+   Evas_Object_Protected_Data *clip;
+   Render_Updates *ru;
+   Eina_Bool added = EINA_FALSE;
+   int i, x, y, w, h;
+
+   for (i = 0; i < num; i++)
+     {
+        if (!scrolls[i].ok) continue;
+        clip = scrolls[i].clipper;
+        x = clip->cur->cache.clip.x + evas->framespace.x;
+        y = clip->cur->cache.clip.y + evas->framespace.y;
+        w = clip->cur->cache.clip.w;
+        h = clip->cur->cache.clip.h;
+        if (!ENFN->output_redraws_motion_add(ENC, out->output, x, y, w, h,
+                                             scrolls[i].dx, scrolls[i].dy))
+          continue;
+        added = EINA_TRUE;
+        if (!make_updates) continue;
+
+        /* the moved pixels are not drawn but they did change on screen */
+        w -= abs(scrolls[i].dx);
+        h -= abs(scrolls[i].dy);
+        if (scrolls[i].dx > 0) x += scrolls[i].dx;
+        if (scrolls[i].dy > 0) y += scrolls[i].dy;
+        ru = malloc(sizeof(*ru));
+        if (!ru) continue;
+        ru->surface = NULL;
+        NEW_RECT(ru->area, x + out->geometry.x, y + out->geometry.y, w, h);
+        eina_spinlock_take(&(evas->render.lock));
+        out->updates = eina_list_append(out->updates, ru);
+        eina_spinlock_release(&(evas->render.lock));
+     }
+   return added;
+}
+
 static void
 _evas_render_phase1_direct(Evas_Public_Data *e,
                            Eina_Inarray *active_objects,
@@ -3300,6 +3520,8 @@ evas_render_updates_internal(Evas *eo_e,
      EVAS_RENDER_MODE_SYNC :
      EVAS_RENDER_MODE_ASYNC_INIT;
    Eina_Bool haveup = EINA_FALSE;
+   Render_Scroll scrolls[RENDER_SCROLL_MAX];
+   int scrolls_num = 0;
    static int show_update_boxes = -1;
 
    MAGIC_CHECK(eo_e, Evas, MAGIC_EVAS);
@@ -3390,6 +3612,12 @@ evas_render_updates_internal(Evas *eo_e,
    OBJS_ARRAY_CLEAN(&e->restack_objects);
    eina_evlog("-render_phase2", eo_e, 0.0, NULL);
 
+   /* phase 2.1. find clipped areas that only scrolled */
+   if ((do_draw) && (ENFN->output_redraws_motion_add) &&
+       (!redraw_all) && (!e->damages) &&
+       (!e->viewport.changed) && (!e->framespace.changed))
+     scrolls_num = _evas_render_scrolls_find(e, scrolls);
+
    /* phase 3. add exposes */
    eina_evlog("+render_phase3", eo_e, 0.0, NULL);
    EINA_LIST_FREE(e->damages, r)
@@ -3492,6 +3720,13 @@ evas_render_updates_internal(Evas *eo_e,
                                            out->geometry.w, out->geometry.h);
              out->changed = EINA_FALSE;
           }
+        /* phase 6.1. let the engine move what only scrolled */
+        else if (scrolls_num)
+          {
+             if (_evas_render_scrolls_output_add(e, out, scrolls, scrolls_num,
+                                                 (do_async) || (make_updates)))
+               haveup = EINA_TRUE;
+          }
 
         /* Define the output for Evas_GL operation */
         if (ENFN->gl_output_set)
@@ -4054,6 +4289,8 @@ evas_render_pipe_wakeup(void *data)
         if (!out->output) continue ;
         EINA_LIST_FOREACH(out->updates, l, ru)
           {
+             // scrolled areas were moved by the engine, nothing to push
+             if (!ru->surface) continue;
              eina_evlog("+render_push", evas->evas, 0.0, NULL);
              ENFN->output_redraws_next_update_push
                (ENC, out->output, ru->surface,
@@ -16,6 +16,7 @@ evas_common_tilebuf_new(int w, int h)
    Tilebuf *tb = malloc(sizeof(Tilebuf));
    tb->outbuf_w = w;
    tb->outbuf_h = h;
+   tb->motion_num = 0;
    tb->region = region_new(tb->outbuf_w, tb->outbuf_h);
    return tb;
 }
@@ -58,17 +59,12 @@ evas_common_tilebuf_del_redraw(Tilebuf *tb, int x, int y, int w, int h)
    return 1;
 }
 
-EVAS_API int
-evas_common_tilebuf_add_motion_vector(Tilebuf *tb EINA_UNUSED, int x EINA_UNUSED, int y EINA_UNUSED, int w EINA_UNUSED, int h EINA_UNUSED, int dx EINA_UNUSED, int dy EINA_UNUSED, int alpha EINA_UNUSED)
-{
-   return 0;
-}
-
 EVAS_API void
 evas_common_tilebuf_clear(Tilebuf *tb)
 {
    region_free(tb->region);
    tb->region = region_new(tb->outbuf_w, tb->outbuf_h);
+   tb->motion_num = 0;
 }
 
 static Region *
@@ -940,12 +936,6 @@ evas_common_tilebuf_del_redraw(Tilebuf *tb, int x, int y, int w, int h)
    return 0;
 }
 
-EVAS_API int
-evas_common_tilebuf_add_motion_vector(Tilebuf *tb EINA_UNUSED, int x EINA_UNUSED, int y EINA_UNUSED, int w EINA_UNUSED, int h EINA_UNUSED, int dx EINA_UNUSED, int dy EINA_UNUSED, int alpha EINA_UNUSED)
-{
-   return 0;
-}
-
 EVAS_API void
 evas_common_tilebuf_clear(Tilebuf *tb)
 {
@@ -953,6 +943,7 @@ evas_common_tilebuf_clear(Tilebuf *tb)
    tb->prev_del.x = tb->prev_del.y = tb->prev_del.w = tb->prev_del.h = 0;
    rect_list_clear(&tb->rects);
    tb->need_merge = 0;
+   tb->motion_num = 0;
 }
 
 EVAS_API Tilebuf_Rect *
@@ -1086,3 +1077,57 @@ evas_common_tilebuf_free_render_rects(Tilebuf_Rect *rects)
    free(rects);
 }
 #endif
+
+/* A motion vector says the content of x, y, w, h moved by dx, dy since the
+ * last frame, so whatever still shows of it can be copied over in the output
+ * buffer instead of being drawn again. The caller still adds the redraws for
+ * the whole area, the engine takes out what it managed to copy. If the moved
+ * pixels have alpha what is below them shows through and does not move along,
+ * so those are refused. */
+EVAS_API int
+evas_common_tilebuf_add_motion_vector(Tilebuf *tb, int x, int y, int w, int h, int dx, int dy, int alpha)
+{
+   Tilebuf_Motion_Vector *mv;
+   int i;
+
+   if ((alpha) || ((!dx) && (!dy))) return 0;
+   if (tb->motion_num >= TILEBUF_MOTION_MAX) return 0;
+   RECTS_CLIP_TO_RECT(x, y, w, h, 0, 0, tb->outbuf_w, tb->outbuf_h);
+   if ((w <= abs(dx)) || (h <= abs(dy))) return 0;
+   // copies are done one after the other, they must not step on each other
+   for (i = 0; i < tb->motion_num; i++)
+     {
+        mv = &(tb->motion[i]);
+        if (RECTS_INTERSECT(x, y, w, h, mv->x, mv->y, mv->w, mv->h))
+          return 0;
+     }
+   mv = &(tb->motion[tb->motion_num++]);
+   mv->x = x;
+   mv->y = y;
+   mv->w = w;
+   mv->h = h;
+   mv->dx = dx;
+   mv->dy = dy;
+   return 1;
+}
+
+EVAS_API const Tilebuf_Motion_Vector *
+evas_common_tilebuf_motion_vectors_get(Tilebuf *tb, int *num)
+{
+   if (num) *num = tb->motion_num;
+   if (!tb->motion_num) return NULL;
+   return tb->motion;
+}
+
+/* The part of a motion vector area that still shows after the move, in the
+ * new frame. Its pixels come from x - dx, y - dy in the last one. */
+EVAS_API void
+evas_common_tilebuf_motion_vector_copy_get(const Tilebuf_Motion_Vector *mv, int *x, int *y, int *w, int *h)
+{
+   *x = mv->x;
+   *y = mv->y;
+   *w = mv->w - abs(mv->dx);
+   *h = mv->h - abs(mv->dy);
+   if (mv->dx > 0) *x += mv->dx;
+   if (mv->dy > 0) *y += mv->dy;
+}
@@ -675,7 +675,9 @@ evas_filter_temporary_buffer_get(Evas_Filter_Context *ctx, int w, int h,
         if (fb->transient && !fb->locked && (fb->alpha_only == alpha_only)
             && (!clean || !fb->dirty))
           {
-             if ((!w || (w == fb->w)) && (!h || (h == fb->h)))
+             // w,h = 0 means full size, don't hand out a downscaled buffer
+             if ((w ? (w == fb->w) : (!fb->w || (fb->w == ctx->w))) &&
+                 (h ? (h == fb->h) : (!fb->h || (fb->h == ctx->h))))
                {
                   fb->locked = EINA_TRUE;
                   return fb;
@@ -900,11 +902,135 @@ _blur_support_gl(Evas_Filter_Context *ctx, Evas_Filter_Buffer *in, Evas_Filter_B
    return cmd.ENFN->gfx_filter_supports(_evas_engine_context(cmd.ctx->evas), &cmd) == EVAS_FILTER_SUPPORT_GL;
 }
 
+// Fast software blur: radius from which we blur a downscaled copy instead
+#define BLUR_DOWNSCALE_RADIUS_MIN 16
+#define BLUR_DOWNSCALE_FACTOR_MAX 8
+
+static int
+_blur_downscale_factor(int radius)
+{
+   int down = 1;
+
+   if (radius < BLUR_DOWNSCALE_RADIUS_MIN) return 1;
+
+   // Keep a radius of at least 4px on the downscaled buffer.
+   while (((down * 2) <= BLUR_DOWNSCALE_FACTOR_MAX) &&
+          ((radius / (down * 2)) >= 4))
+     down *= 2;
+
+   return down;
+}
+
+static Evas_Filter_Command *
+_blur_add_downscaled(Evas_Filter_Context *ctx, void *drawctx,
+                     Evas_Filter_Buffer *in, Evas_Filter_Buffer *out,
+                     int dx, int dy, int ox, int oy, int down_x, int down_y,
+                     Eina_Bool alphaonly)
+{
+   Evas_Filter_Command *cmd = NULL;
+   Evas_Filter_Buffer *small[2], *big, *cur;
+   Evas_Filter_Blur_Type type;
+   int pad_x, pad_y, ww, hh, render_op;
+
+   /* SW fast blur implementation:
+    *
+    * - Create intermediate buffers S1, S2 and B
+    * - Downscale input to S1 (average of down_x*down_y blocks)
+    * - Apply X and Y box blurs between S1 and S2
+    * - Upscale the result to B (bilinear)
+    * - Blend B into the output with the current color, offset and op
+    *
+    * Same as GL, the sampling grid is aligned on the object's position so
+    * that the output doesn't flicker when the object moves.
+    */
+
+   pad_x = ((ctx->x % down_x) + down_x) % down_x;
+   pad_y = ((ctx->y % down_y) + down_y) % down_y;
+   ww = (ctx->w + pad_x + down_x - 1) / down_x;
+   hh = (ctx->h + pad_y + down_y - 1) / down_y;
+   dx = (dx + down_x / 2) / down_x;
+   dy = (dy + down_y / 2) / down_y;
+
+   small[0] = evas_filter_temporary_buffer_get(ctx, ww, hh, in->alpha_only, EINA_FALSE);
+   if (!small[0]) goto fail;
+   small[1] = evas_filter_temporary_buffer_get(ctx, ww, hh, in->alpha_only, EINA_FALSE);
+   if (!small[1]) goto fail;
+   big = evas_filter_temporary_buffer_get(ctx, 0, 0, in->alpha_only, EINA_FALSE);
+   if (!big) goto fail;
+
+   XDBG("Add SW downscale %d (%dx%d) -> %d (%dx%d)", in->id, ctx->w, ctx->h, small[0]->id, ww, hh);
+   cmd = _command_new(ctx, EVAS_FILTER_MODE_BLEND, in, NULL, small[0]);
+   if (!cmd) goto fail;
+   cmd->draw.scale.down = EINA_TRUE;
+   cmd->draw.scale.pad_x = pad_x;
+   cmd->draw.scale.pad_y = pad_y;
+   cmd->draw.scale.factor_x = down_x;
+   cmd->draw.scale.factor_y = down_y;
+   cmd->draw.rop = EFL_GFX_RENDER_OP_COPY;
+   cur = small[0];
+
+   if (dx)
+     {
+        type = (dx <= 2) ? EVAS_FILTER_BLUR_GAUSSIAN : EVAS_FILTER_BLUR_BOX;
+        XDBG("Add horizontal blur %d -> %d (%dpx)", cur->id, small[1]->id, dx);
+        cmd = _command_new(ctx, EVAS_FILTER_MODE_BLUR, cur, NULL, small[1]);
+        if (!cmd) goto fail;
+        cmd->blur.type = type;
+        cmd->blur.dx = dx;
+        cmd->blur.count = 1;
+        cmd->blur.auto_count = EINA_TRUE;
+        cur = small[1];
+     }
+
+   if (dy)
+     {
+        Evas_Filter_Buffer *dst = (cur == small[0]) ? small[1] : small[0];
+
+        type = (dy <= 2) ? EVAS_FILTER_BLUR_GAUSSIAN : EVAS_FILTER_BLUR_BOX;
+        XDBG("Add vertical blur %d -> %d (%dpx)", cur->id, dst->id, dy);
+        cmd = _command_new(ctx, EVAS_FILTER_MODE_BLUR, cur, NULL, dst);
+        if (!cmd) goto fail;
+        cmd->blur.type = type;
+        cmd->blur.dy = dy;
+        cmd->blur.count = 1;
+        cmd->blur.auto_count = EINA_TRUE;
+        cur = dst;
+     }
+
+   XDBG("Add SW upscale %d (%dx%d) -> %d (%dx%d)", cur->id, ww, hh, big->id, ctx->w, ctx->h);
+   cmd = _command_new(ctx, EVAS_FILTER_MODE_BLEND, cur, NULL, big);
+   if (!cmd) goto fail;
+   cmd->draw.scale.down = EINA_FALSE;
+   cmd->draw.scale.pad_x = pad_x;
+   cmd->draw.scale.pad_y = pad_y;
+   cmd->draw.scale.factor_x = down_x;
+   cmd->draw.scale.factor_y = down_y;
+   cmd->draw.rop = EFL_GFX_RENDER_OP_COPY;
+
+   // The blur overrides its output when blurring a buffer in place
+   render_op = ENFN->context_render_op_get(ENC, drawctx);
+   if (in == out)
+     ENFN->context_render_op_set(ENC, drawctx, EVAS_RENDER_COPY);
+   cmd = evas_filter_command_blend_add(ctx, drawctx, big->id, out->id, ox, oy,
+                                       EVAS_FILTER_FILL_MODE_NONE, alphaonly);
+   if (in == out)
+     ENFN->context_render_op_set(ENC, drawctx, render_op);
+   if (!cmd) goto fail;
+
+   _filter_buffer_unlock_all(ctx);
+   return cmd;
+
+fail:
+   ERR("Failed to add blur");
+   _filter_buffer_unlock_all(ctx);
+   return NULL;
+}
+
 Evas_Filter_Command *
 evas_filter_command_blur_add(Evas_Filter_Context *ctx, void *drawctx,
                              int inbuf, int outbuf, Evas_Filter_Blur_Type type,
                              int dx, int dy, int ox, int oy, int count,
-                             Eina_Bool alphaonly)
+                             Eina_Bool alphaonly, Eina_Bool fast)
 {
    Evas_Filter_Buffer *in = NULL, *out = NULL, *tmp = NULL, *in_dy = NULL;
    Evas_Filter_Buffer *out_dy = NULL, *out_dx = NULL;
@@ -943,6 +1069,16 @@ evas_filter_command_blur_add(Evas_Filter_Context *ctx, void *drawctx,
      return evas_filter_command_blur_add_gl(ctx, in, out, type, dx, dy, ox, oy,
                                             count, R, G, B, A, alphaonly);
 
+   if (fast && (type == EVAS_FILTER_BLUR_DEFAULT))
+     {
+        int down_x = _blur_downscale_factor(dx);
+        int down_y = _blur_downscale_factor(dy);
+
+        if ((down_x > 1) || (down_y > 1))
+          return _blur_add_downscaled(ctx, drawctx, in, out, dx, dy, ox, oy,
+                                      down_x, down_y, alphaonly);
+     }
+
    // Note (SW engine):
    // The basic blur operation overrides the pixels in the target buffer,
    // only supports one direction (X or Y) and no offset. As a consequence
@@ -999,7 +1135,7 @@ evas_filter_command_blur_add(Evas_Filter_Context *ctx, void *drawctx,
                 if (dy) ENFN->context_color_set(ENC, drawctx, 255, 255, 255, 255);
                 cmd = evas_filter_command_blur_add(ctx, drawctx, inbuf, tmp_out,
                                                    type, dx, 0, tmp_ox, tmp_oy, 0,
-                                                   alphaonly);
+                                                   alphaonly, EINA_FALSE);
                 if (!cmd) goto fail;
                 cmd->blur.auto_count = EINA_TRUE;
                 if (dy) ENFN->context_color_set(ENC, drawctx, R, G, B, A);
@@ -1017,7 +1153,7 @@ evas_filter_command_blur_add(Evas_Filter_Context *ctx, void *drawctx,
                   ENFN->context_render_op_set(ENC, drawctx, EVAS_RENDER_COPY);
                 cmd = evas_filter_command_blur_add(ctx, drawctx, tmp_in, outbuf,
                                                    type, 0, dy, ox, oy, 0,
-                                                   alphaonly);
+                                                   alphaonly, EINA_FALSE);
                 if (dx && (inbuf == outbuf))
                   ENFN->context_render_op_set(ENC, drawctx, render_op);
                 if (!cmd) goto fail;
@@ -1299,7 +1435,7 @@ evas_filter_command_grow_add(Evas_Filter_Context *ctx, void *draw_context,
    blurcmd = evas_filter_command_blur_add(ctx, draw_context, inbuf, growbuf,
                                           EVAS_FILTER_BLUR_DEFAULT,
                                           abs(radius), abs(radius), 0, 0, 0,
-                                          alphaonly);
+                                          alphaonly, EINA_FALSE);
    EINA_SAFETY_ON_NULL_GOTO(blurcmd, fail);
 
    if (diam > 255) diam = 255;
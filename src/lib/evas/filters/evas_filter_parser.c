@@ -251,6 +251,7 @@ static const char *_lua_color_meta = "color";
 static Evas_Filter_Fill_Mode _fill_mode_get(Evas_Filter_Instruction *instr);
 static Eina_Bool _lua_instruction_run(lua_State *L, Evas_Filter_Instruction *instr);
 static int _lua_backtrace(lua_State *L);
+static Evas_Filter_Program *_lua_program_get(lua_State *L);
 
 typedef enum
 {
@@ -293,6 +294,7 @@ struct _Instruction_Param
       Buffer *buf;
       struct {
          void *data;
+         size_t size; // of data, so the parameter can be copied
          Eina_Bool (*func)(lua_State *L, int i, Evas_Filter_Program *, Evas_Filter_Instruction *, Instruction_Param *);
       } special;
    } value;
@@ -319,6 +321,8 @@ struct _Evas_Filter_Instruction
 struct _Evas_Filter_Program
 {
    Eina_Stringshare *name; // Optional for now
+   Eina_Stringshare *code;
+   Eina_Stringshare *cache_key; // Key of the current instructions, if cached
    Eina_Hash /* const char * : Evas_Filter_Proxy_Binding */ *proxies;
    Eina_Inlist /* Evas_Filter_Instruction */ *instructions;
    Eina_Inlist /* Buffer */ *buffers;
@@ -336,6 +340,7 @@ struct _Evas_Filter_Program
    Eina_Bool padding_set : 1; // Padding has been forced
    Eina_Bool changed : 1; // State (w,h) changed, needs re-run of Lua
    Eina_Bool input_alpha : 1;
+   Eina_Bool size_used : 1; // Lua code read a buffer's size, can't be cached
 };
 
 /* Instructions */
@@ -664,11 +669,13 @@ _lua_buffer_index(lua_State *L)
 
    if (!strcmp(key, "w") || !strcmp(key, "width"))
      {
+        _lua_program_get(L)->size_used = EINA_TRUE;
         lua_pushinteger(L, buf->w);
         return 1;
      }
    else if (!strcmp(key, "h") || !strcmp(key, "height"))
      {
+        _lua_program_get(L)->size_used = EINA_TRUE;
         lua_pushinteger(L, buf->h);
         return 1;
      }
@@ -1090,7 +1097,7 @@ _blur_padding_update(Evas_Filter_Program *pgm EINA_UNUSED,
   Apply blur effect on a buffer (box or gaussian).
 
   @verbatim
-  blur ({ rx = 3, ry = nil, type = 'default', ox = 0, oy = 0, color = 'white', src = input, dst = output })
+  blur ({ rx = 3, ry = nil, type = 'default', ox = 0, oy = 0, color = 'white', src = input, dst = output, quality = 'high' })
   @endverbatim
 
   @param rx    X radius. Specifies the radius of the blurring kernel (X direction).
@@ -1104,6 +1111,9 @@ _blur_padding_update(Evas_Filter_Program *pgm EINA_UNUSED,
   @param src   Source buffer to blur.
   @param dst   Destination buffer for blending.
   @param count Number of times to repeat the blur. Only valid with @c box blur. Valid range is: 1 to 6.
+  @param quality One of @c high or @c fast. With @c fast, large @c default blurs (16px and more)
+                 are computed on a downscaled copy of the buffer and scaled back up, which
+                 is a lot faster but less precise. The GL engine always does this.
 
   The blur type @c default is <b>recommended in all situations</b> as it will select the smoothest
   and fastest operation possible depending on the kernel size. Instead of running a real
@@ -1144,6 +1154,7 @@ _blur_instruction_prepare(Evas_Filter_Program *pgm, Evas_Filter_Instruction *ins
    _instruction_param_name_add(instr, "dst", VT_BUFFER, _buffer_get(pgm, "output"));
    _instruction_param_name_add(instr, "count", VT_INT, 0);
    _instruction_param_name_add(instr, "alphaonly", VT_BOOL, EINA_FALSE);
+   _instruction_param_name_add(instr, "quality", VT_STRING, "high");
 
    return EINA_TRUE;
 }
@@ -1341,6 +1352,7 @@ _lua_curve_points_func(lua_State *L, int i, Evas_Filter_Program *pgm EINA_UNUSED
    param->value.special.data = malloc(sizeof(values));
    if (!param->value.special.data) return EINA_FALSE;
    memcpy(param->value.special.data, values, sizeof(values));
+   param->value.special.size = sizeof(values);
 
    return EINA_TRUE;
 }
@@ -1949,6 +1961,8 @@ evas_filter_program_del(Evas_Filter_Program *pgm)
         _instruction_del(instr);
      }
 
+   eina_stringshare_del(pgm->cache_key);
+   eina_stringshare_del(pgm->code);
    eina_stringshare_del(pgm->name);
    free(pgm);
 }
@@ -2853,22 +2867,211 @@ _filter_program_reset(Evas_Filter_Program *pgm)
    return _filter_program_state_set(pgm);
 }
 
-/** Parse a style program */
+/* Programs cache
+ *
+ * Running the Lua code is expensive (state creation, compilation and
+ * execution) and most objects use the same few programs, eg. a shadow on
+ * every label of a theme. So the resulting instructions and buffers are
+ * kept in a cache, keyed by everything the Lua code can see. Objects using
+ * a cached program simply get a copy and don't need a Lua state at all.
+ * Programs reading a buffer's size depend on the object's geometry and are
+ * not cached, and neither are the in-between states of a transition, as
+ * each frame of the animation would add its own entry. When the cache is
+ * full the least recently used program is dropped.
+ */
 
-EVAS_API Eina_Bool
-evas_filter_program_parse(Evas_Filter_Program *pgm, const char *str)
+#define FILTER_PROGRAMS_CACHE_MAX 256
+
+typedef struct _Filter_Program_Template
+{
+   EINA_INLIST;
+   Eina_Stringshare *key;
+   Eina_Inlist /* Evas_Filter_Instruction */ *instructions;
+   Eina_Inlist /* Buffer */ *buffers;
+   int last_bufid;
+} Filter_Program_Template;
+
+static Eina_Hash *_programs_cache = NULL;
+static Eina_Inlist *_programs_lru = NULL; // Most recently used first
+
+static void
+_instructions_buffers_free(Eina_Inlist **instructions, Eina_Inlist **buffers)
+{
+   Evas_Filter_Instruction *instr;
+   Buffer *buf;
+
+   EINA_INLIST_FREE(*instructions, instr)
+     {
+        *instructions = eina_inlist_remove(*instructions, EINA_INLIST_GET(instr));
+        _instruction_del(instr);
+     }
+
+   EINA_INLIST_FREE(*buffers, buf)
+     {
+        *buffers = eina_inlist_remove(*buffers, EINA_INLIST_GET(buf));
+        _buffer_del(buf);
+     }
+}
+
+static void
+_program_template_free(void *data)
+{
+   Filter_Program_Template *tpl = data;
+
+   if (!tpl) return;
+   _programs_lru = eina_inlist_remove(_programs_lru, EINA_INLIST_GET(tpl));
+   _instructions_buffers_free(&tpl->instructions, &tpl->buffers);
+   eina_stringshare_del(tpl->key);
+   free(tpl);
+}
+
+static Evas_Filter_Instruction *
+_instruction_clone(const Evas_Filter_Instruction *src, Eina_Inlist *buffers)
+{
+   Evas_Filter_Instruction *instr;
+   Instruction_Param *sp, *param;
+   Buffer *buf;
+
+   instr = _instruction_new(src->name);
+   if (!instr) return NULL;
+   instr->type = src->type;
+   instr->return_count = src->return_count;
+   instr->parse_run = src->parse_run;
+   instr->pad.update = src->pad.update;
+   instr->valid = src->valid;
+
+   EINA_INLIST_FOREACH(src->params, sp)
+     {
+        param = calloc(1, sizeof(Instruction_Param));
+        if (!param) goto fail;
+        param->name = eina_stringshare_ref(sp->name);
+        param->type = sp->type;
+        param->set = sp->set;
+        param->allow_seq = sp->allow_seq;
+        param->allow_any_string = sp->allow_any_string;
+        instr->params = eina_inlist_append(instr->params, EINA_INLIST_GET(param));
+
+        switch (sp->type)
+          {
+           case VT_STRING:
+             if (!sp->value.s) break;
+             param->value.s = strdup(sp->value.s);
+             if (!param->value.s) goto fail;
+             break;
+           case VT_BUFFER:
+             if (!sp->value.buf) break;
+             EINA_INLIST_FOREACH(buffers, buf)
+               if (buf->name == sp->value.buf->name)
+                 {
+                    param->value.buf = buf;
+                    break;
+                 }
+             if (!param->value.buf) goto fail;
+             break;
+           case VT_SPECIAL:
+             param->value.special.func = sp->value.special.func;
+             if (!sp->value.special.data) break;
+             if (!sp->value.special.size) goto fail;
+             param->value.special.data = malloc(sp->value.special.size);
+             if (!param->value.special.data) goto fail;
+             memcpy(param->value.special.data, sp->value.special.data,
+                    sp->value.special.size);
+             param->value.special.size = sp->value.special.size;
+             break;
+           default:
+             param->value = sp->value;
+             break;
+          }
+     }
+
+   return instr;
+
+fail:
+   _instruction_del(instr);
+   return NULL;
+}
+
+static Eina_Bool
+_instructions_buffers_clone(Eina_Inlist **instructions, Eina_Inlist **buffers,
+                            Eina_Inlist *src_instructions, Eina_Inlist *src_buffers)
+{
+   Evas_Filter_Instruction *instr, *si;
+   Buffer *buf, *sb;
+
+   EINA_INLIST_FOREACH(src_buffers, sb)
+     {
+        buf = calloc(1, sizeof(Buffer));
+        if (!buf) goto fail;
+        *buf = *sb;
+        memset(EINA_INLIST_GET(buf), 0, sizeof(Eina_Inlist));
+        buf->name = eina_stringshare_ref(sb->name);
+        buf->proxy = eina_stringshare_ref(sb->proxy);
+        *buffers = eina_inlist_append(*buffers, EINA_INLIST_GET(buf));
+     }
+
+   EINA_INLIST_FOREACH(src_instructions, si)
+     {
+        instr = _instruction_clone(si, *buffers);
+        if (!instr) goto fail;
+        *instructions = eina_inlist_append(*instructions, EINA_INLIST_GET(instr));
+     }
+
+   return EINA_TRUE;
+
+fail:
+   _instructions_buffers_free(instructions, buffers);
+   return EINA_FALSE;
+}
+
+static Eina_Stringshare *
+_filter_program_cache_key_get(Evas_Filter_Program *pgm)
+{
+   const Efl_Canvas_Filter_State *st = &pgm->state;
+   Evas_Filter_Data_Binding *db;
+   Eina_Stringshare *key;
+   Eina_Strbuf *buf;
+
+#define COL(c) ARGB_JOIN(st->c.a, st->c.r, st->c.g, st->c.b)
+
+   // Everything the Lua code sees, except the size (see size_used)
+   buf = eina_strbuf_new();
+   eina_strbuf_append_printf(buf, "%d %08x %08x %08x %08x %08x %a %a %s:%a %s:%a\n",
+                             pgm->input_alpha, COL(color), COL(text.outline),
+                             COL(text.shadow), COL(text.glow), COL(text.glow2),
+                             st->scale, st->pos, st->cur.name ? st->cur.name : "",
+                             st->cur.value, st->next.name ? st->next.name : "",
+                             st->next.value);
+   if (pgm->proxies)
+     {
+        Eina_Iterator *it = eina_hash_iterator_key_new(pgm->proxies);
+        const char *source;
+
+        EINA_ITERATOR_FOREACH(it, source)
+          eina_strbuf_append_printf(buf, "src %s\n", source);
+        eina_iterator_free(it);
+     }
+   EINA_INLIST_FOREACH(pgm->data, db)
+     eina_strbuf_append_printf(buf, "data%s %s=%s\n", db->execute ? "!" : "",
+                               db->name, db->value ? db->value : "(nil)");
+   eina_strbuf_append(buf, pgm->code);
+
+   key = eina_stringshare_add(eina_strbuf_string_get(buf));
+   eina_strbuf_free(buf);
+   return key;
+
+#undef COL
+}
+
+static Eina_Bool
+_filter_program_lua_load(Evas_Filter_Program *pgm)
 {
    lua_State *L;
    Eina_Bool ok;
 
-   EINA_SAFETY_ON_NULL_RETURN_VAL(pgm, EINA_FALSE);
-   EINA_SAFETY_ON_NULL_RETURN_VAL(str, EINA_FALSE);
-   EINA_SAFETY_ON_FALSE_RETURN_VAL(*str != 0, EINA_FALSE);
-
    L = _lua_state_create(pgm);
    if (!L) return EINA_FALSE;
 
-   ok = !luaL_loadstring(L, str);
+   ok = !luaL_loadstring(L, pgm->code);
    if (!ok)
      {
         ERR("Failed to load Lua program: %s", lua_tostring(L, -1));
@@ -2877,37 +3080,152 @@ evas_filter_program_parse(Evas_Filter_Program *pgm, const char *str)
 #ifdef FILTERS_LEGACY_COMPAT
    if (!ok)
      {
-        char *code = _legacy_strdup(str);
+        char *code = _legacy_strdup(pgm->code);
         DBG("Fallback to transformed legacy code:\n%s", code);
         ok = !luaL_loadstring(L, code);
         free(code);
      }
 #endif
 
+   if (!ok)
+     {
+        ERR("Lua parsing failed: %s", lua_tostring(L, -1));
+        lua_close(L);
+        pgm->L = NULL;
+        return EINA_FALSE;
+     }
+
+   pgm->lua_func = luaL_ref(L, LUA_REGISTRYINDEX);
+   return EINA_TRUE;
+}
+
+/* Builds the list of instructions for the current state. */
+static Eina_Bool
+_filter_program_run(Evas_Filter_Program *pgm)
+{
+   Filter_Program_Template *tpl = NULL;
+   Eina_Stringshare *key = NULL;
+   Eina_Bool ok;
+
+   // A transition that is being animated never hits the cache twice
+   if ((pgm->state.pos <= 0.0) || (pgm->state.pos >= 1.0))
+     key = _filter_program_cache_key_get(pgm);
+   if (key && pgm->cache_key && (key == pgm->cache_key))
+     {
+        // Only the size changed and the program doesn't care
+        eina_stringshare_del(key);
+        return EINA_TRUE;
+     }
+   eina_stringshare_replace(&pgm->cache_key, NULL);
+
+   if (key && _programs_cache)
+     tpl = eina_hash_find(_programs_cache, key);
+   if (tpl)
+     {
+        _programs_lru = eina_inlist_promote(_programs_lru, EINA_INLIST_GET(tpl));
+        _instructions_buffers_free(&pgm->instructions, &pgm->buffers);
+        if (_instructions_buffers_clone(&pgm->instructions, &pgm->buffers,
+                                        tpl->instructions, tpl->buffers))
+          {
+             XDBG("Using cached filter program for '%s'", pgm->name);
+             pgm->last_bufid = tpl->last_bufid;
+             pgm->cache_key = key;
+             return EINA_TRUE;
+          }
+     }
+
+   if (!pgm->L && !_filter_program_lua_load(pgm))
+     {
+        eina_stringshare_del(key);
+        return EINA_FALSE;
+     }
+
+   pgm->size_used = EINA_FALSE;
+   ok = _filter_program_reset(pgm);
    if (ok)
      {
-        pgm->lua_func = luaL_ref(L, LUA_REGISTRYINDEX);
-        ok =_filter_program_reset(pgm);
-        if (ok)
+        lua_getglobal(pgm->L, _lua_errfunc_name);
+        lua_rawgeti(pgm->L, LUA_REGISTRYINDEX, pgm->lua_func);
+        ok = !lua_pcall(pgm->L, 0, LUA_MULTRET, -2);
+        if (!ok)
+          ERR("Lua execution failed: %s", lua_tostring(pgm->L, -1));
+     }
+
+   // tpl is only set here if it was found but could not be copied
+   if (!ok || !key || tpl || pgm->size_used || !pgm->instructions)
+     {
+        eina_stringshare_del(key);
+        return ok;
+     }
+
+   if (!_programs_cache)
+     _programs_cache = eina_hash_string_superfast_new(_program_template_free);
+   while (_programs_lru &&
+          (eina_hash_population(_programs_cache) >= FILTER_PROGRAMS_CACHE_MAX))
+     {
+        Filter_Program_Template *old;
+
+        old = EINA_INLIST_CONTAINER_GET(_programs_lru->last, Filter_Program_Template);
+        eina_hash_del_by_key(_programs_cache, old->key);
+     }
+
+   tpl = calloc(1, sizeof(Filter_Program_Template));
+   if (tpl && _instructions_buffers_clone(&tpl->instructions, &tpl->buffers,
+                                          pgm->instructions, pgm->buffers))
+     {
+        tpl->last_bufid = pgm->last_bufid;
+        tpl->key = eina_stringshare_ref(key);
+        if (eina_hash_add(_programs_cache, key, tpl))
           {
-             lua_getglobal(L, _lua_errfunc_name);
-             lua_rawgeti(L, LUA_REGISTRYINDEX, pgm->lua_func);
-             ok = !lua_pcall(L, 0, LUA_MULTRET, -2);
+             _programs_lru = eina_inlist_prepend(_programs_lru, EINA_INLIST_GET(tpl));
+             pgm->cache_key = key;
+          }
+        else
+          {
+             _instructions_buffers_free(&tpl->instructions, &tpl->buffers);
+             eina_stringshare_del(tpl->key);
+             free(tpl);
+             eina_stringshare_del(key);
           }
      }
+   else
+     {
+        free(tpl);
+        eina_stringshare_del(key);
+     }
 
-   if (!ok)
+   return EINA_TRUE;
+}
+
+/** Parse a style program */
+
+EVAS_API Eina_Bool
+evas_filter_program_parse(Evas_Filter_Program *pgm, const char *str)
+{
+   Eina_Bool ok;
+
+   EINA_SAFETY_ON_NULL_RETURN_VAL(pgm, EINA_FALSE);
+   EINA_SAFETY_ON_NULL_RETURN_VAL(str, EINA_FALSE);
+   EINA_SAFETY_ON_FALSE_RETURN_VAL(*str != 0, EINA_FALSE);
+
+   if (pgm->L)
      {
-        const char *msg = lua_tostring(L, -1);
-        ERR("Lua parsing failed: %s", msg);
-        lua_close(L);
+        lua_close(pgm->L);
         pgm->L = NULL;
      }
-   else if (!pgm->instructions)
+   eina_stringshare_replace(&pgm->code, str);
+   eina_stringshare_replace(&pgm->cache_key, NULL);
+
+   ok = _filter_program_run(pgm);
+   if (ok && !pgm->instructions)
      {
         ERR("No instructions found in Lua script");
-        lua_close(L);
         ok = EINA_FALSE;
+     }
+
+   if (!ok && pgm->L)
+     {
+        lua_close(pgm->L);
         pgm->L = NULL;
      }
    pgm->valid = ok;
@@ -3153,11 +3471,11 @@ _instr2cmd_blur(Evas_Filter_Context *ctx,
    Eina_Bool colorset = EINA_FALSE, yset = EINA_FALSE, cntset = EINA_FALSE;
    Evas_Filter_Blur_Type type = EVAS_FILTER_BLUR_DEFAULT;
    Evas_Filter_Command *cmd;
-   const char *typestr;
+   const char *typestr, *qualitystr;
    DATA32 color;
    Buffer *src, *dst;
    int ox, oy, rx, ry, A, R, G, B, count;
-   Eina_Bool alphaonly;
+   Eina_Bool alphaonly, fast = EINA_FALSE;
 
    ox = _instruction_param_geti(instr, "ox", NULL);
    oy = _instruction_param_geti(instr, "oy", NULL);
@@ -3169,9 +3487,18 @@ _instr2cmd_blur(Evas_Filter_Context *ctx,
    src = _instruction_param_getbuf(instr, "src", NULL);
    dst = _instruction_param_getbuf(instr, "dst", NULL);
    alphaonly = _instruction_param_getb(instr, "alphaonly", NULL);
+   qualitystr = _instruction_param_gets(instr, "quality", NULL);
    INSTR_PARAM_CHECK(src);
    INSTR_PARAM_CHECK(dst);
 
+   if (qualitystr)
+     {
+        if (!strcasecmp(qualitystr, "fast"))
+          fast = EINA_TRUE;
+        else if (strcasecmp(qualitystr, "high"))
+          ERR("Unknown blur quality '%s'. Using high quality.", qualitystr);
+     }
+
    if (typestr)
      {
         if (!strcasecmp(typestr, "gaussian"))
@@ -3202,7 +3529,7 @@ _instr2cmd_blur(Evas_Filter_Context *ctx,
    if (!yset) ry = rx;
    if (colorset) SETCOLOR(color);
    cmd = evas_filter_command_blur_add(ctx, dc, src->cid, dst->cid, type,
-                                      rx, ry, ox, oy, count, alphaonly);
+                                      rx, ry, ox, oy, count, alphaonly, fast);
    if (colorset) RESETCOLOR();
 
    return cmd;
@@ -3627,16 +3954,8 @@ evas_filter_context_program_use(void *engine, void *output,
    if (pgm->changed)
      {
         pgm->changed = EINA_FALSE;
-        _filter_program_reset(pgm);
-        lua_getglobal(pgm->L, _lua_errfunc_name);
-        lua_rawgeti(pgm->L, LUA_REGISTRYINDEX, pgm->lua_func);
-        success = !lua_pcall(pgm->L, 0, LUA_MULTRET, -2);
-        if (!success)
-          {
-             const char *msg = lua_tostring(pgm->L, -1);
-             ERR("Lua execution failed: %s", msg);
-             goto end;
-          }
+        if (!_filter_program_run(pgm))
+          goto end;
      }
 
    // Create or update all buffers
@@ -3670,4 +3989,7 @@ evas_filter_parser_shutdown(void)
 {
    free(_lua_color_code);
    _lua_color_code = NULL;
+   if (_programs_cache) eina_hash_free(_programs_cache);
+   _programs_cache = NULL;
+   _programs_lru = NULL;
 }
@@ -383,6 +383,7 @@ typedef struct _Convert_Pal             Convert_Pal;
 
 typedef struct _Tilebuf                 Tilebuf;
 typedef struct _Tilebuf_Rect            Tilebuf_Rect;
+typedef struct _Tilebuf_Motion_Vector   Tilebuf_Motion_Vector;
 
 #ifndef NEWTILER
 typedef struct _Tilebuf_Tile            Tilebuf_Tile;
@@ -918,9 +919,19 @@ struct rect_node
 };
 #endif
 
+#define TILEBUF_MOTION_MAX 4
+
+struct _Tilebuf_Motion_Vector
+{
+   int x, y, w, h;
+   int dx, dy;
+};
+
 struct _Tilebuf
 {
    int outbuf_w, outbuf_h;
+   Tilebuf_Motion_Vector motion[TILEBUF_MOTION_MAX];
+   int motion_num;
 #ifdef NEWTILER
    void *region;
 #else
@@ -1075,6 +1086,8 @@ EVAS_API void          evas_common_tilebuf_tile_strict_set   (Tilebuf *tb, Eina_
 EVAS_API int           evas_common_tilebuf_add_redraw        (Tilebuf *tb, int x, int y, int w, int h);
 EVAS_API int           evas_common_tilebuf_del_redraw        (Tilebuf *tb, int x, int y, int w, int h);
 EVAS_API int           evas_common_tilebuf_add_motion_vector (Tilebuf *tb, int x, int y, int w, int h, int dx, int dy, int alpha);
+EVAS_API const Tilebuf_Motion_Vector *evas_common_tilebuf_motion_vectors_get (Tilebuf *tb, int *num);
+EVAS_API void          evas_common_tilebuf_motion_vector_copy_get (const Tilebuf_Motion_Vector *mv, int *x, int *y, int *w, int *h);
 EVAS_API void          evas_common_tilebuf_clear             (Tilebuf *tb);
 EVAS_API Tilebuf_Rect *evas_common_tilebuf_get_render_rects  (Tilebuf *tb);
 EVAS_API void          evas_common_tilebuf_free_render_rects (Tilebuf_Rect *rects);
@@ -178,10 +178,11 @@ Evas_Filter_Command     *evas_filter_command_blend_add(Evas_Filter_Context *ctx,
  * @param oy             Y offset in the destination buffer
  * @param count          Number of times to repeat the operation (used for smooth fast blurs with box blur)
  * @param alphaonly      If true, discard RGB during RGBA -> Alpha conversions.
+ * @param fast           If true, large DEFAULT blurs may run on a downscaled copy of the input (software only, GL always does)
  * @return               Filter command ID or -1 in case of error
  * @internal
  */
-Evas_Filter_Command     *evas_filter_command_blur_add(Evas_Filter_Context *ctx, void *draw_context, int inbuf, int outbuf, Evas_Filter_Blur_Type type, int dx, int dy, int ox, int oy, int count, Eina_Bool alphaonly);
+Evas_Filter_Command     *evas_filter_command_blur_add(Evas_Filter_Context *ctx, void *draw_context, int inbuf, int outbuf, Evas_Filter_Blur_Type type, int dx, int dy, int ox, int oy, int count, Eina_Bool alphaonly, Eina_Bool fast);
 
 /**
  * @brief Fill a buffer with the current color
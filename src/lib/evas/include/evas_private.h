@@ -487,6 +487,9 @@ struct _Evas_Public_Data
 
    Eina_List     *rendering;
 
+   Eina_Hash     *event_index; // hit test grids of long object lists, key: list head
+   int            event_index_walking;
+
    unsigned char  changed : 1;
    unsigned char  delete_me : 1;
    unsigned char  invalidate : 1;
@@ -499,6 +502,7 @@ struct _Evas_Public_Data
    Eina_Bool      cb_render_post : 1;
    Eina_Bool      cb_render_flush_pre : 1;
    Eina_Bool      cb_render_flush_post : 1;
+   Eina_Bool      event_index_valid : 1;
 };
 
 struct _Evas_Layer
@@ -1083,6 +1087,8 @@ struct _Evas_Func
 
    void (*font_glyphs_gc_collect)   (void *engine, float ratio, int *texture_size, int *atlas_size, Eina_Bool only_when_requested);
 
+   Eina_Bool (*output_redraws_motion_add) (void *engine, void *data, int x, int y, int w, int h, int dx, int dy);
+
    unsigned int info_size;
 };
 
@@ -1185,6 +1191,7 @@ void evas_object_callbacks_shutdown(Eo *eo_obj EINA_UNUSED, Evas_Object_Protecte
 
 void evas_object_event_callback_call(Evas_Object *obj, Evas_Object_Protected_Data *pd, Evas_Callback_Type type, void *event_info, int event_id, const Efl_Event_Description *efl_event_desc);
 Eina_List *evas_event_objects_event_list(Evas *e, Evas_Object *stop, int x, int y);
+void evas_event_index_invalidate(Evas_Public_Data *e);
 void evas_debug_error(void);
 void evas_debug_input_null(void);
 void evas_debug_generic(const char *str);
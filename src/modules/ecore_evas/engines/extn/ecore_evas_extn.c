@@ -18,7 +18,10 @@
 # define EMODAPI
 #endif
 
-#define NBUF 2
+// the socket renders into the buffer after the one it last sent, so with 3
+// it never touches the two the plug may still be showing, and never blocks
+// on the buffer lock waiting for the plug to finish drawing
+#define NBUF 3
 
 static int blank = 0x00000000;
 static const char *interface_extn_name = "extn";
@@ -1426,6 +1429,7 @@ _ecore_evas_socket_resize(Ecore_Evas *ee, int w, int h)
              einfo->info.func.free_update_region = NULL;
              einfo->info.func.switch_buffer = _ecore_evas_socket_switch;
              einfo->info.switch_data = ee;
+             einfo->switch_buffers = NBUF;
              if (!evas_engine_info_set(ee->evas, (Evas_Engine_Info *)einfo))
                {
                   ERR("evas_engine_info_set() for engine '%s' failed.", ee->driver);
@@ -2187,6 +2191,7 @@ ecore_evas_extn_socket_new_internal(int w, int h)
         einfo->info.func.free_update_region = NULL;
         einfo->info.func.switch_buffer = _ecore_evas_socket_switch;
         einfo->info.switch_data = ee;
+        einfo->switch_buffers = NBUF;
         if (!evas_engine_info_set(ee->evas, (Evas_Engine_Info *)einfo))
           {
              ERR("evas_engine_info_set() for engine '%s' failed.", ee->driver);
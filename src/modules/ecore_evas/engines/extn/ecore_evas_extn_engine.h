@@ -54,7 +54,7 @@ Eina_Bool   _extnbuf_lock_file_set(Extnbuf *b, const char *file);
 Eina_Bool   _extnbuf_lock_get(const Extnbuf *b);
 
 // procotol version - change this as needed
-#define MAJOR 0x2011
+#define MAJOR 0x2012
 
 enum // opcodes
 {
@@ -37,6 +37,9 @@ struct _Evas_Engine_Info_Buffer
 
    /* non-blocking or blocking mode */
    Evas_Engine_Render_Mode render_mode;
+
+   /* buffers switch_buffer cycles through, 0 is 2. Kept last for ABI. */
+   int switch_buffers;
 };
 #endif
 
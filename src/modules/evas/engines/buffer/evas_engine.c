@@ -71,7 +71,8 @@ eng_output_setup(void *engine, void *in, unsigned int w, unsigned int h)
                                         info->info.func.new_update_region,
                                         info->info.func.free_update_region,
                                         info->info.func.switch_buffer,
-                                        info->info.switch_data);
+                                        info->info.switch_data,
+                                        info->switch_buffers);
    if (!ob) goto on_error;
 
    if (!evas_render_engine_software_generic_init(engine, re, ob,
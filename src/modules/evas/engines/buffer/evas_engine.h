@@ -41,6 +41,7 @@ struct _Outbuf
    void                         *dest;
    unsigned int                  dest_row_bytes;
    void                         *switch_data;
+   int                           switch_buffers;
 
    int                           alpha_level;
    DATA32                        color_key;
@@ -74,12 +75,14 @@ void         evas_buffer_outbuf_buf_update_fb              (Outbuf *buf,
                                                             void * (*new_update_region) (int x, int y, int w, int h, int *row_bytes),
                                                             void   (*free_update_region) (int x, int y, int w, int h, void *data),
                                                             void * (*switch_buffer) (void *data, void *dest_buffer),
-                                                            void *switch_data);
+                                                            void *switch_data,
+                                                            int switch_buffers);
 Outbuf      *evas_buffer_outbuf_buf_setup_fb               (int w, int h, Outbuf_Depth depth, void *dest, int dest_row_bytes, int use_color_key, DATA32 color_key, int alpha_level,
 							    void * (*new_update_region) (int x, int y, int w, int h, int *row_bytes),
 							    void   (*free_update_region) (int x, int y, int w, int h, void *data),
                                                             void * (*switch_buffer)(void *switch_data, void *dest),
-                                                            void *switch_data);
+                                                            void *switch_data,
+                                                            int switch_buffers);
 
 
 void         evas_buffer_outbuf_reconfigure                (Outbuf *ob, int w, int h, int rot, Outbuf_Depth depth);
@@ -23,7 +23,8 @@ evas_buffer_outbuf_buf_update_fb(Outbuf *buf, int w, int h, Outbuf_Depth depth,
                                 void * (*new_update_region) (int x, int y, int w, int h, int *row_bytes),
                                 void   (*free_update_region) (int x, int y, int w, int h, void *data),
                                 void * (*switch_buffer) (void *data, void *dest_buffer),
-                                void *switch_data)
+                                void *switch_data,
+                                int switch_buffers)
 {
    buf->w = w;
    buf->h = h;
@@ -41,6 +42,7 @@ evas_buffer_outbuf_buf_update_fb(Outbuf *buf, int w, int h, Outbuf_Depth depth,
    buf->func.free_update_region = free_update_region;
    buf->func.switch_buffer = switch_buffer;
    buf->switch_data = switch_data;
+   buf->switch_buffers = switch_buffers;
 
    if ((buf->depth == OUTBUF_DEPTH_ARGB_32BPP_8888_8888) &&
        (buf->dest) && (buf->dest_row_bytes == (buf->w * sizeof(DATA32))))
@@ -68,7 +70,8 @@ evas_buffer_outbuf_buf_setup_fb(int w, int h, Outbuf_Depth depth, void *dest, in
                                 void * (*new_update_region) (int x, int y, int w, int h, int *row_bytes),
                                 void   (*free_update_region) (int x, int y, int w, int h, void *data),
                                 void * (*switch_buffer) (void *data, void *dest_buffer),
-                                void *switch_data)
+                                void *switch_data,
+                                int switch_buffers)
 {
    Outbuf *buf;
 
@@ -87,7 +90,8 @@ evas_buffer_outbuf_buf_setup_fb(int w, int h, Outbuf_Depth depth, void *dest, in
                                     new_update_region,
                                     free_update_region,
                                     switch_buffer,
-                                    switch_data);
+                                    switch_data,
+                                    switch_buffers);
 
    return buf;
 }
@@ -396,6 +400,7 @@ evas_buffer_outbuf_reconfigure(Outbuf *ob, int w, int h, int rot EINA_UNUSED, Ou
    void   (*free_update_region) (int x, int y, int w, int h, void *data);
    void * (*switch_buffer) (void *switch_data, void *dest);
    void    *switch_data;
+   int      switch_buffers;
 
    if (depth == OUTBUF_DEPTH_INHERIT) depth = ob->depth;
    dest = ob->dest;
@@ -407,6 +412,7 @@ evas_buffer_outbuf_reconfigure(Outbuf *ob, int w, int h, int rot EINA_UNUSED, Ou
    free_update_region = ob->func.free_update_region;
    switch_buffer = ob->func.switch_buffer;
    switch_data = ob->switch_data;
+   switch_buffers = ob->switch_buffers;
 
    evas_buffer_outbuf_buf_update_fb(ob,
                                     w,
@@ -420,14 +426,18 @@ evas_buffer_outbuf_reconfigure(Outbuf *ob, int w, int h, int rot EINA_UNUSED, Ou
                                     new_update_region,
                                     free_update_region,
                                     switch_buffer,
-                                    switch_data);
+                                    switch_data,
+                                    switch_buffers);
 }
 
 Render_Output_Swap_Mode
 evas_buffer_outbuf_buf_swap_mode_get(Outbuf *ob)
 {
-   if (ob->func.switch_buffer) return MODE_DOUBLE;
-   return MODE_FULL;
+   if (!ob->func.switch_buffer) return MODE_FULL;
+   // the buffer we switch to holds what was drawn that many frames ago
+   if (ob->switch_buffers >= 4) return MODE_QUADRUPLE;
+   if (ob->switch_buffers == 3) return MODE_TRIPLE;
+   return MODE_DOUBLE;
 }
 
 int
@@ -56,6 +56,7 @@ eng_output_setup(void *engine, void *in, unsigned int w, unsigned int h)
 
    /* no backbuf! */
    evas_fb_outbuf_fb_set_have_backbuf(ob, 0);
+   evas_render_engine_software_generic_blit_set(re, evas_fb_outbuf_fb_blit);
    _outbufs = eina_list_append(_outbufs, ob);
    return re;
 
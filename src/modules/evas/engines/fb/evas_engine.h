@@ -55,7 +55,7 @@ void         evas_fb_outbuf_fb_free                   (Outbuf *buf);
 
 Outbuf      *evas_fb_outbuf_fb_setup_fb               (int w, int h, int rot, Outbuf_Depth depth, int vt_no, int dev_no, int refresh);
 
-void         evas_fb_outbuf_fb_blit                   (Outbuf *buf, int src_x, int src_y, int w, int h, int dst_x, int dst_y);
+Eina_Bool    evas_fb_outbuf_fb_blit                   (Outbuf *buf, int src_x, int src_y, int w, int h, int dst_x, int dst_y);
 void         evas_fb_outbuf_fb_update                 (Outbuf *buf, int x, int y, int w, int h);
 void        *evas_fb_outbuf_fb_new_region_for_update  (Outbuf *buf, int x, int y, int w, int h, int *cx, int *cy, int *cw, int *ch);
 void         evas_fb_outbuf_fb_free_region_for_update (Outbuf *buf, RGBA_Image *update);
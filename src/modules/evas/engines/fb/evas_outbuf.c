@@ -146,7 +146,33 @@ evas_fb_outbuf_fb_setup_fb(int w, int h, int rot, Outbuf_Depth depth, int vt_no,
    return buf;
 }
 
-void
+static void
+_outbuf_fb_rect_rotate(Outbuf *buf, int *x, int *y, int *w, int *h)
+{
+   int tx = *x, ty = *y, tw = *w, th = *h;
+
+   if (buf->rot == 180)
+     {
+        *x = buf->w - tx - tw;
+        *y = buf->h - ty - th;
+     }
+   else if (buf->rot == 270)
+     {
+        *x = buf->h - ty - th;
+        *y = tx;
+        *w = th;
+        *h = tw;
+     }
+   else if (buf->rot == 90)
+     {
+        *x = ty;
+        *y = buf->w - tx - tw;
+        *w = th;
+        *h = tw;
+     }
+}
+
+Eina_Bool
 evas_fb_outbuf_fb_blit(Outbuf *buf, int src_x, int src_y, int w, int h, int dst_x, int dst_y)
 {
    if (buf->priv.back_buf)
@@ -154,14 +180,42 @@ evas_fb_outbuf_fb_blit(Outbuf *buf, int src_x, int src_y, int w, int h, int dst_
 	evas_common_blit_rectangle(buf->priv.back_buf, buf->priv.back_buf,
 		       src_x, src_y, w, h, dst_x, dst_y);
 	evas_fb_outbuf_fb_update(buf, dst_x, dst_y, w, h);
+        return EINA_TRUE;
      }
    else
      {
 	if (buf->priv.fb.fb)
 	  {
-	     /* FIXME: need to implement an fb call for "copy area" */
+             DATA8 *mem, *src, *dst;
+             int dw = w, dh = h, row, pitch, bpp, len;
+
+             /* the fb is only written to, so it still holds the last frame
+              * and we can move things around in it directly */
+             _outbuf_fb_rect_rotate(buf, &src_x, &src_y, &w, &h);
+             _outbuf_fb_rect_rotate(buf, &dst_x, &dst_y, &dw, &dh);
+             bpp = buf->priv.fb.fb->bpp;
+             pitch = bpp * buf->priv.fb.fb->stride;
+             len = bpp * w;
+             mem = (DATA8 *)buf->priv.fb.fb->mem + buf->priv.fb.fb->mem_offset;
+             src = mem + (src_y * pitch) + (src_x * bpp);
+             dst = mem + (dst_y * pitch) + (dst_x * bpp);
+             if (dst > src)
+               {
+                  /* moving down the rows overlap from the bottom up */
+                  src += (h - 1) * pitch;
+                  dst += (h - 1) * pitch;
+                  for (row = 0; row < h; row++, src -= pitch, dst -= pitch)
+                    memmove(dst, src, len);
+               }
+             else
+               {
+                  for (row = 0; row < h; row++, src += pitch, dst += pitch)
+                    memmove(dst, src, len);
+               }
+             return EINA_TRUE;
 	  }
      }
+   return EINA_FALSE;
 }
 
 void
@@ -48,6 +48,7 @@ typedef void (*Outbuf_Free)(Outbuf *ob);
 typedef int (*Outbuf_Get_Rot)(Outbuf *ob);
 typedef void (*Outbuf_Flush)(Outbuf *ob, Tilebuf_Rect *surface_damage, Tilebuf_Rect *buffer_damage, Evas_Render_Mode render_mode);
 typedef void (*Outbuf_Redraws_Clear)(Outbuf *ob);
+typedef Eina_Bool (*Outbuf_Blit)(Outbuf *ob, int src_x, int src_y, int w, int h, int dst_x, int dst_y);
 
 struct _Render_Output_Software_Generic
 {
@@ -69,6 +70,7 @@ struct _Render_Output_Software_Generic
    Outbuf_Free outbuf_free;
    Outbuf_Flush outbuf_flush;
    Outbuf_Redraws_Clear outbuf_redraws_clear;
+   Outbuf_Blit outbuf_blit;
 
    unsigned int w, h;
 
@@ -123,6 +125,7 @@ evas_render_engine_software_generic_init(Render_Engine_Software_Generic *engine,
    re->outbuf_free = outbuf_free;
    re->outbuf_flush = outbuf_flush;
    re->outbuf_redraws_clear = outbuf_redraws_clear;
+   re->outbuf_blit = NULL;
 
    re->rects = NULL;
    for (i = 0; i < 4; i++)
@@ -194,6 +197,16 @@ evas_render_engine_software_generic_tile_strict_set(Render_Output_Software_Gener
    evas_common_tilebuf_tile_strict_set(re->tb, re->tile_strict);
 }
 
+/* Outbufs that draw straight into a buffer still holding the last frame can
+ * copy areas around in it, which lets scrolled content be moved instead of
+ * being drawn again. */
+static inline void
+evas_render_engine_software_generic_blit_set(Render_Output_Software_Generic *re,
+                                             Outbuf_Blit outbuf_blit)
+{
+   re->outbuf_blit = outbuf_blit;
+}
+
 static inline Eina_Bool
 evas_render_engine_software_generic_update(Render_Output_Software_Generic *re,
                                            Outbuf *ob,
@@ -2545,6 +2545,68 @@ _map_image_smooth_draw(RGBA_Image *src, RGBA_Image *dst, RGBA_Draw_Context *dc,
    return EINA_TRUE;
 }
 
+typedef struct _Map_Draw_Band Map_Draw_Band;
+
+struct _Map_Draw_Band
+{
+   Evas_Thread_Command_Map *map;
+   RGBA_Map_Point *pts;
+   int y;
+};
+
+static void
+_map_draw_band(void *data, int start, int end)
+{
+   Map_Draw_Band *band = data;
+   Evas_Thread_Command_Map *map = band->map;
+   RGBA_Map_Point pts[4];
+
+   // the map renderer clamps the points it is given, each band gets a copy
+   memcpy(pts, band->pts, sizeof(pts));
+   evas_common_map_rgba_draw
+     (map->image, map->surface,
+      map->clip.x, band->y + start, map->clip.w, end - start,
+      map->mul_col, map->render_op, 4, pts,
+      map->smooth, map->anti_alias, map->level,
+      map->mask, map->mask_x, map->mask_y);
+   evas_common_cpu_end_opt();
+}
+
+static void
+_map_draw_bands(Evas_Thread_Command_Map *map, RGBA_Map_Point *p)
+{
+   RGBA_Image *im = map->image;
+   Map_Draw_Band band;
+   int i, ytop, ybottom;
+
+   // every row of a quad is rendered from the edges alone, so the rows it
+   // covers can be split in bands across the helper threads. Bands only
+   // spread the work: texture coordinates are still interpolated linearly
+   // along edges and spans (see the "do z persp" FIXMEs in evas_map_image.c)
+   // and sampled bilinearly when smooth, exactly as on a single thread.
+   ytop = ybottom = p[0].y;
+   for (i = 1; i < 4; i++)
+     {
+        if (p[i].y < ytop) ytop = p[i].y;
+        if (p[i].y > ybottom) ybottom = p[i].y;
+     }
+   ytop >>= FP;
+   ybottom = (ybottom >> FP) + 1;
+   if (ytop < map->clip.y) ytop = map->clip.y;
+   if (ybottom > (map->clip.y + map->clip.h)) ybottom = map->clip.y + map->clip.h;
+   if (ytop >= ybottom) return;
+
+   // a translucent point marks the source as having alpha, do it once here
+   // rather than from every band
+   for (i = 0; i < 4; i++)
+     if ((p[i].col >> 24) < 0xff) im->cache_entry.flags.alpha = EINA_TRUE;
+
+   band.map = map;
+   band.pts = p;
+   band.y = ytop;
+   eng_filter_parallel_run(_map_draw_band, &band, ybottom - ytop);
+}
+
 static void
 _draw_thread_map_draw(void *data)
 {
@@ -2615,8 +2677,11 @@ _draw_thread_map_draw(void *data)
              map->image_ctx->mul.col = col;
              map->image_ctx->mul.use = use;
           }
+        else if (!(map->anti_alias && map->smooth))
+          _map_draw_bands(map, &m->pts[offset]);
         else
           {
+             // the anti-aliased renderer keeps its state in globals
              evas_common_map_rgba_draw
                (im, map->surface,
                 map->clip.x, map->clip.y, map->clip.w, map->clip.h,
@@ -3855,6 +3920,20 @@ eng_output_redraws_rect_del(void *engine, int x, int y, int w, int h)
      evas_common_tilebuf_del_redraw(re->tb, x, y, w, h);
 }
 
+static Eina_Bool
+eng_output_redraws_motion_add(void *engine EINA_UNUSED, void *data, int x, int y, int w, int h, int dx, int dy)
+{
+   Render_Output_Software_Generic *re;
+   int mode = MODE_COPY;
+
+   re = (Render_Output_Software_Generic *)data;
+   // copying only works if what we draw into next still holds the last frame
+   if ((!re->outbuf_blit) || (re->lost_back)) return EINA_FALSE;
+   if (re->outbuf_swap_mode_get) mode = re->outbuf_swap_mode_get(re->ob);
+   if (mode != MODE_COPY) return EINA_FALSE;
+   return !!evas_common_tilebuf_add_motion_vector(re->tb, x, y, w, h, dx, dy, 0);
+}
+
 static void
 eng_output_redraws_clear(void *engine EINA_UNUSED, void *data)
 {
@@ -4104,6 +4183,34 @@ _merge_rects(Render_Output_Merge_Mode merge_mode,
 }
 
 
+static Eina_Bool
+_motion_blit(Render_Output_Software_Generic *re, Tilebuf_Rect *damage,
+             const Tilebuf_Motion_Vector *motion, int num)
+{
+   const Tilebuf_Motion_Vector *mv;
+   Tilebuf_Rect *r;
+   int i, x, y, w, h;
+   Eina_Bool done = EINA_FALSE;
+
+   if (!re->outbuf_blit) return EINA_FALSE;
+   for (i = 0; i < num; i++)
+     {
+        mv = &(motion[i]);
+        // the part of the area that is still visible after the move
+        evas_common_tilebuf_motion_vector_copy_get(mv, &x, &y, &w, &h);
+        if (!re->outbuf_blit(re->ob, x - mv->dx, y - mv->dy, w, h, x, y))
+          continue;
+        if (!done)
+          {
+             EINA_INLIST_FOREACH(EINA_INLIST_GET(damage), r)
+               evas_common_tilebuf_add_redraw(re->tb, r->x, r->y, r->w, r->h);
+             done = EINA_TRUE;
+          }
+        evas_common_tilebuf_del_redraw(re->tb, x, y, w, h);
+     }
+   return done;
+}
+
 static void *
 eng_output_redraws_next_update_get(void *engine EINA_UNUSED, void *data, int *x, int *y, int *w, int *h, int *cx, int *cy, int *cw, int *ch)
 {
@@ -4127,8 +4234,12 @@ eng_output_redraws_next_update_get(void *engine EINA_UNUSED, void *data, int *x,
 
    if (!re->rects)
      {
-        int mode = MODE_COPY;
+        Tilebuf_Motion_Vector motion[TILEBUF_MOTION_MAX];
+        const Tilebuf_Motion_Vector *mv;
+        int mode = MODE_COPY, motion_num = 0;
 
+        mv = evas_common_tilebuf_motion_vectors_get(re->tb, &motion_num);
+        if (mv) memcpy(motion, mv, motion_num * sizeof(Tilebuf_Motion_Vector));
         re->rects = evas_common_tilebuf_get_render_rects(re->tb);
         if (re->rects)
           {
@@ -4142,6 +4253,7 @@ eng_output_redraws_next_update_get(void *engine EINA_UNUSED, void *data, int *x,
                {
                   /* if we lost our backbuffer since the last frame redraw all */
                   re->lost_back = 0;
+                  motion_num = 0;
                   evas_common_tilebuf_add_redraw(re->tb, 0, 0, re->w, re->h);
                   evas_common_tilebuf_free_render_rects(re->rects);
                   re->rects = evas_common_tilebuf_get_render_rects(re->tb);
@@ -4159,9 +4271,17 @@ eng_output_redraws_next_update_get(void *engine EINA_UNUSED, void *data, int *x,
                {
                 case MODE_AUTO:
                 case MODE_FULL:
-                case MODE_COPY: // no prev rects needed
                   re->rects = _merge_rects(re->merge_mode, re->tb, re->rects_prev[0], NULL, NULL, NULL);
                   break;
+                case MODE_COPY: // no prev rects needed
+                  /* scrolled areas are copied over from the last frame and
+                   * left out of what we draw, rects_prev keeps them though */
+                  if ((motion_num) &&
+                      (_motion_blit(re, re->rects_prev[0], motion, motion_num)))
+                    re->rects = _merge_rects(re->merge_mode, re->tb, NULL, NULL, NULL, NULL);
+                  else
+                    re->rects = _merge_rects(re->merge_mode, re->tb, re->rects_prev[0], NULL, NULL, NULL);
+                  break;
                 case MODE_DOUBLE: // double mode - only 1 level of prev rect
                   re->rects = _merge_rects(re->merge_mode, re->tb, re->rects_prev[0], re->rects_prev[1], NULL, NULL);
                   break;
@@ -4847,6 +4967,7 @@ static Evas_Func func =
      eng_gfx_filter_process,
    /* FUTURE software generic calls go here */
      eng_font_glyphs_gc_collect,
+     eng_output_redraws_motion_add,
      0 // sizeof (Info)
 };
 
@@ -5976,6 +6097,7 @@ module_open(Evas_Module *em)
 //   init_gl();
    ector_glsym_set(dlsym, RTLD_DEFAULT);
    evas_common_pipe_init();
+   eng_filter_parallel_init();
 
    em->functions = (void *)(&func);
    cpunum = eina_cpu_count();
@@ -5985,6 +6107,7 @@ module_open(Evas_Module *em)
 static void
 module_close(Evas_Module *em EINA_UNUSED)
 {
+   eng_filter_parallel_shutdown();
    ector_shutdown();
    eina_mempool_del(_mp_command_rect);
    eina_mempool_del(_mp_command_line);
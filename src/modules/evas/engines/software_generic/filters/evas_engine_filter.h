@@ -16,4 +16,9 @@ Software_Filter_Func eng_filter_transform_func_get(Evas_Filter_Command *cmd);
 Software_Filter_Func eng_filter_grayscale_func_get(Evas_Filter_Command *cmd);
 Software_Filter_Func eng_filter_inverse_color_func_get(Evas_Filter_Command *cmd);
 
+typedef void (* Eng_Filter_Band_Func) (void *data, int start, int end);
+void eng_filter_parallel_init(void);
+void eng_filter_parallel_shutdown(void);
+void eng_filter_parallel_run(Eng_Filter_Band_Func func, void *data, int len);
+
 #endif // EVAS_ENGINE_FILTER_H
@@ -446,6 +446,215 @@ _mapped_blend(void *drawctx,
    return ret;
 }
 
+/* Integer factor down and up scaling, used by the fast blur. Input and
+ * output have the same colorspace and the output is simply overwritten.
+ * pad_x,pad_y shift the sampling grid, so it stays aligned on the object.
+ */
+
+static void
+_scale_up_coords_get(int *pos, int *frac, int len, int factor, int pad, int max)
+{
+   for (int k = 0; k < len; k++)
+     {
+        // center of the output pixel in input coordinates, 8 bits fraction
+        int u = (((2 * (k + pad) + 1) << 8) / (2 * factor)) - 128;
+
+        if (u < 0) u = 0;
+        pos[k] = u >> 8;
+        frac[k] = u & 0xff;
+        if (pos[k] >= (max - 1))
+          {
+             pos[k] = max - 1;
+             frac[k] = 0;
+          }
+     }
+}
+
+static void
+_scale_down_alpha(const uint8_t *src, int sstride, int sw, int sh,
+                  uint8_t *dst, int dstride, int dw, int dh,
+                  int fx, int fy, int px, int py)
+{
+   for (int y = 0; y < dh; y++, dst += dstride)
+     {
+        int y0 = MAX(0, y * fy - py);
+        int y1 = MIN(sh, y * fy - py + fy);
+
+        for (int x = 0; x < dw; x++)
+          {
+             int x0 = MAX(0, x * fx - px);
+             int x1 = MIN(sw, x * fx - px + fx);
+             int cnt = (x1 - x0) * (y1 - y0);
+             int sum = 0;
+
+             if (cnt <= 0)
+               {
+                  dst[x] = 0;
+                  continue;
+               }
+             for (int yy = y0; yy < y1; yy++)
+               {
+                  const uint8_t *s = src + (yy * sstride);
+                  for (int xx = x0; xx < x1; xx++)
+                    sum += s[xx];
+               }
+             dst[x] = sum / cnt;
+          }
+     }
+}
+
+static void
+_scale_down_rgba(const uint32_t *src, int sstride, int sw, int sh,
+                 uint32_t *dst, int dstride, int dw, int dh,
+                 int fx, int fy, int px, int py)
+{
+   for (int y = 0; y < dh; y++, dst += dstride)
+     {
+        int y0 = MAX(0, y * fy - py);
+        int y1 = MIN(sh, y * fy - py + fy);
+
+        for (int x = 0; x < dw; x++)
+          {
+             int x0 = MAX(0, x * fx - px);
+             int x1 = MIN(sw, x * fx - px + fx);
+             int cnt = (x1 - x0) * (y1 - y0);
+             int a = 0, r = 0, g = 0, b = 0;
+
+             if (cnt <= 0)
+               {
+                  dst[x] = 0;
+                  continue;
+               }
+             for (int yy = y0; yy < y1; yy++)
+               {
+                  const uint32_t *s = src + (yy * sstride);
+                  for (int xx = x0; xx < x1; xx++)
+                    {
+                       a += (s[xx] >> 24);
+                       r += (s[xx] >> 16) & 0xff;
+                       g += (s[xx] >> 8) & 0xff;
+                       b += s[xx] & 0xff;
+                    }
+               }
+             dst[x] = ARGB_JOIN(a / cnt, r / cnt, g / cnt, b / cnt);
+          }
+     }
+}
+
+static void
+_scale_up_alpha(const uint8_t *src, int sstride, int sw, int sh,
+                uint8_t *dst, int dstride, int dw, int dh,
+                int fx, int fy, int px, int py)
+{
+   int *xpos, *xfrac, ypos, yfrac;
+
+   xpos = alloca(dw * sizeof(int));
+   xfrac = alloca(dw * sizeof(int));
+   _scale_up_coords_get(xpos, xfrac, dw, fx, px, sw);
+
+   for (int y = 0; y < dh; y++, dst += dstride)
+     {
+        const uint8_t *s0, *s1;
+
+        _scale_up_coords_get(&ypos, &yfrac, 1, fy, y + py, sh);
+        s0 = src + (ypos * sstride);
+        s1 = yfrac ? (s0 + sstride) : s0;
+
+        for (int x = 0; x < dw; x++)
+          {
+             const int xp = xpos[x], xa = xfrac[x];
+             int v0 = s0[xp], v1 = s1[xp];
+
+             if (xa)
+               {
+                  v0 = ((v0 * (256 - xa)) + (s0[xp + 1] * xa)) >> 8;
+                  v1 = ((v1 * (256 - xa)) + (s1[xp + 1] * xa)) >> 8;
+               }
+             dst[x] = ((v0 * (256 - yfrac)) + (v1 * yfrac)) >> 8;
+          }
+     }
+}
+
+static void
+_scale_up_rgba(const uint32_t *src, int sstride, int sw, int sh,
+               uint32_t *dst, int dstride, int dw, int dh,
+               int fx, int fy, int px, int py)
+{
+   int *xpos, *xfrac, ypos, yfrac;
+
+   xpos = alloca(dw * sizeof(int));
+   xfrac = alloca(dw * sizeof(int));
+   _scale_up_coords_get(xpos, xfrac, dw, fx, px, sw);
+
+   for (int y = 0; y < dh; y++, dst += dstride)
+     {
+        const uint32_t *s0, *s1;
+
+        _scale_up_coords_get(&ypos, &yfrac, 1, fy, y + py, sh);
+        s0 = src + (ypos * sstride);
+        s1 = yfrac ? (s0 + sstride) : s0;
+
+        for (int x = 0; x < dw; x++)
+          {
+             const int xp = xpos[x], xa = xfrac[x];
+             uint32_t c0 = s0[xp], c1 = s1[xp];
+
+             if (xa)
+               {
+                  c0 = INTERP_256(xa, s0[xp + 1], c0);
+                  c1 = INTERP_256(xa, s1[xp + 1], c1);
+               }
+             dst[x] = yfrac ? INTERP_256(yfrac, c1, c0) : c0;
+          }
+     }
+}
+
+static Eina_Bool
+_filter_scale_cpu(Evas_Filter_Command *cmd)
+{
+   unsigned int src_len, src_stride, dst_len, dst_stride;
+   int sw, sh, dw, dh, fx, fy, px, py;
+   Eina_Bool alpha = cmd->output->alpha_only;
+   void *src, *dst;
+
+   ector_buffer_size_get(cmd->input->buffer, &sw, &sh);
+   ector_buffer_size_get(cmd->output->buffer, &dw, &dh);
+   if ((dw <= 0) || (dh <= 0) || (sw <= 0) || (sh <= 0))
+     return EINA_TRUE;
+
+   fx = MAX(1, cmd->draw.scale.factor_x);
+   fy = MAX(1, cmd->draw.scale.factor_y);
+   px = cmd->draw.scale.pad_x;
+   py = cmd->draw.scale.pad_y;
+
+   src = _buffer_map_all(cmd->input->buffer, &src_len, E_READ, alpha ? E_ALPHA : E_ARGB, &src_stride);
+   dst = _buffer_map_all(cmd->output->buffer, &dst_len, E_WRITE, alpha ? E_ALPHA : E_ARGB, &dst_stride);
+   EINA_SAFETY_ON_FALSE_GOTO(src && dst, end);
+
+   XDBG("scale %s: %dx%d --> %dx%d (factor %dx%d, pad %d,%d)",
+        cmd->draw.scale.down ? "down" : "up", sw, sh, dw, dh, fx, fy, px, py);
+
+   if (alpha)
+     {
+        if (cmd->draw.scale.down)
+          _scale_down_alpha(src, src_stride, sw, sh, dst, dst_stride, dw, dh, fx, fy, px, py);
+        else
+          _scale_up_alpha(src, src_stride, sw, sh, dst, dst_stride, dw, dh, fx, fy, px, py);
+     }
+   else
+     {
+        if (cmd->draw.scale.down)
+          _scale_down_rgba(src, src_stride / 4, sw, sh, dst, dst_stride / 4, dw, dh, fx, fy, px, py);
+        else
+          _scale_up_rgba(src, src_stride / 4, sw, sh, dst, dst_stride / 4, dw, dh, fx, fy, px, py);
+     }
+
+end:
+   if (src) ector_buffer_unmap(cmd->input->buffer, src, src_len);
+   if (dst) ector_buffer_unmap(cmd->output->buffer, dst, dst_len);
+   return (src && dst);
+}
+
 Software_Filter_Func
 eng_filter_blend_func_get(Evas_Filter_Command *cmd)
 {
@@ -453,6 +662,13 @@ eng_filter_blend_func_get(Evas_Filter_Command *cmd)
    EINA_SAFETY_ON_NULL_RETURN_VAL(cmd->output, NULL);
    EINA_SAFETY_ON_NULL_RETURN_VAL(cmd->input, NULL);
 
+   if ((cmd->draw.scale.factor_x > 1) || (cmd->draw.scale.factor_y > 1))
+     {
+        // No colorspace conversion when scaling
+        EINA_SAFETY_ON_FALSE_RETURN_VAL(cmd->input->alpha_only == cmd->output->alpha_only, NULL);
+        return _filter_scale_cpu;
+     }
+
    if (cmd->input->alpha_only)
      {
         if (cmd->output->alpha_only)
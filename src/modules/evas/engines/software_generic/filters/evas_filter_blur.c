@@ -229,6 +229,58 @@ _rect(int x, int y, int w, int h, int maxw, int maxh)
 
 #define RECT(_x, _y, _w, _h) _rect(_x, _y, _w, _h, w, h)
 
+typedef struct
+{
+   void *src, *dst;
+   int src_stride, dst_stride; // in pixels
+   int *radii;
+   Eina_Rectangle region;
+   Eina_Bool vert, rgba;
+} Box_Blur_Band;
+
+/* Blurs rows [start, end) of the region, or columns for a vertical blur. */
+static void
+_box_blur_band(void *data, int start, int end)
+{
+   Box_Blur_Band *band = data;
+   Eina_Rectangle r = band->region;
+
+   if (band->vert)
+     {
+        r.x += start;
+        r.w = end - start;
+     }
+   else
+     {
+        r.y += start;
+        r.h = end - start;
+     }
+
+   if (band->rgba)
+     {
+        if (!band->vert)
+          _box_blur_horiz_rgba(band->src, band->src_stride, band->dst, band->dst_stride, band->radii, r);
+        else
+          _box_blur_vert_rgba(band->src, band->src_stride, band->dst, band->dst_stride, band->radii, r);
+     }
+   else
+     {
+        if (!band->vert)
+          {
+             // the alpha horizontal kernel ignores region.y and walks
+             // region.w sized rows from the start of the buffer
+             const uint8_t *src = band->src;
+             uint8_t *dst = band->dst;
+
+             _box_blur_horiz_alpha(src + start * band->region.w, band->src_stride,
+                                   dst + start * band->region.w, band->dst_stride,
+                                   band->radii, r);
+          }
+        else
+          _box_blur_vert_alpha(band->src, band->src_stride, band->dst, band->dst_stride, band->radii, r);
+     }
+}
+
 static Eina_Bool
 _box_blur_apply(Evas_Filter_Command *cmd, Eina_Bool vert, Eina_Bool rgba)
 {
@@ -236,6 +288,7 @@ _box_blur_apply(Evas_Filter_Command *cmd, Eina_Bool vert, Eina_Bool rgba)
    Eina_Bool ret = EINA_FALSE;
    Eina_Rectangle o, region[4];
    int radii[7] = {0};
+   Box_Blur_Band band;
    int radius, regions, w, h;
    void *src, *dst;
 
@@ -252,6 +305,9 @@ _box_blur_apply(Evas_Filter_Command *cmd, Eina_Bool vert, Eina_Bool rgba)
    w = cmd->input->w;
    h = cmd->input->h;
    o = cmd->ctx->obscured.effective;
+   // The obscured region doesn't apply to downscaled buffers (fast blur)
+   if ((w != cmd->ctx->w) || (h != cmd->ctx->h))
+     o.w = o.h = 0;
    if (!o.w || !o.h)
      {
         region[0] = RECT(0, 0, w, h);
@@ -277,23 +333,26 @@ _box_blur_apply(Evas_Filter_Command *cmd, Eina_Bool vert, Eina_Bool rgba)
      }
 
    XDBG("Box blur on image %dx%d obscured by %d,%d %dx%d", w, h, o.x, o.y, o.w, o.h);
+   band.src = src;
+   band.dst = dst;
+   band.src_stride = rgba ? (int) src_stride / 4 : (int) src_stride;
+   band.dst_stride = rgba ? (int) dst_stride / 4 : (int) dst_stride;
+   band.radii = radii;
+   band.vert = vert;
+   band.rgba = rgba;
    for (int k = 0; k < regions; k++)
      {
         XDBG("Box blur in region %d,%d %dx%d", region[k].x, region[k].y, region[k].w, region[k].h);
-        if (rgba)
+        band.region = region[k];
+        if (!rgba && vert)
           {
-             if (!vert)
-               _box_blur_horiz_rgba(src, src_stride / 4, dst, dst_stride / 4, radii, region[k]);
-             else
-               _box_blur_vert_rgba(src, src_stride / 4, dst, dst_stride / 4, radii, region[k]);
+             // the alpha vertical kernel walks columns with region.w as
+             // its stride, so it can't be split
+             _box_blur_band(&band, 0, region[k].w);
           }
         else
-          {
-             if (!vert)
-               _box_blur_horiz_alpha(src, src_stride, dst, dst_stride, radii, region[k]);
-             else
-               _box_blur_vert_alpha(src, src_stride, dst, dst_stride, radii, region[k]);
-          }
+          eng_filter_parallel_run(_box_blur_band, &band,
+                                  vert ? region[k].w : region[k].h);
      }
 
    ret = EINA_TRUE;
@@ -0,0 +1,231 @@
+#include "evas_engine_filter.h"
+
+#include "Ecore.h"
+
+/* A few helper threads the filter kernels (and the map renderer) can split
+ * their work across, in bands of rows or columns. Only one user at a time
+ * can have them (the async render thread and the main loop may both run
+ * filters), anyone else just runs its kernel in one go like before.
+ */
+
+#define FILTER_THREADS_MAX 3
+#define FILTER_BAND_MIN 32
+
+typedef struct _Filter_Thread Filter_Thread;
+typedef struct _Filter_Band_Msg Filter_Band_Msg;
+
+struct _Filter_Band_Msg
+{
+   Eina_Thread_Queue_Msg head;
+   Eng_Filter_Band_Func func; // NULL asks the thread to quit
+   void *data;
+   int start, end;
+};
+
+struct _Filter_Thread
+{
+   Eina_Thread thread;
+   Eina_Thread_Queue *queue;
+};
+
+static Filter_Thread _threads[FILTER_THREADS_MAX];
+static int _threads_count = 0;
+static Eina_Thread_Queue *_done_queue = NULL;
+static Eina_Lock _lock;
+static Eina_Bool _inited = EINA_FALSE;
+static Eina_Bool _started = EINA_FALSE;
+
+static void
+_filter_thread_noop(void *data EINA_UNUSED, int start EINA_UNUSED, int end EINA_UNUSED)
+{
+}
+
+static void *
+_filter_thread(void *data, Eina_Thread t EINA_UNUSED)
+{
+   Filter_Thread *th = data;
+   Filter_Band_Msg *msg;
+   Eng_Filter_Band_Func func;
+   void *fdata, *ref;
+   int start, end;
+
+   eina_thread_name_set(eina_thread_self(), "Evas-filter");
+   do
+     {
+        msg = eina_thread_queue_wait(th->queue, &ref);
+        if (!msg)
+          {
+             func = _filter_thread_noop;
+             continue;
+          }
+
+        func = msg->func;
+        fdata = msg->data;
+        start = msg->start;
+        end = msg->end;
+        eina_thread_queue_wait_done(th->queue, ref);
+
+        if (func) func(fdata, start, end);
+
+        msg = eina_thread_queue_send(_done_queue, sizeof (Filter_Band_Msg), &ref);
+        msg->func = NULL;
+        eina_thread_queue_send_done(_done_queue, ref);
+     }
+   while (func);
+
+   return NULL;
+}
+
+static void
+_filter_threads_start(void)
+{
+   int n;
+
+   _started = EINA_TRUE;
+
+//Eina_Thread_Queue doesn't work on WIN32.
+#ifdef _WIN32
+   return;
+#endif
+
+   n = eina_cpu_count() - 1;
+   if (n > FILTER_THREADS_MAX) n = FILTER_THREADS_MAX;
+   if (n <= 0) return;
+
+   _done_queue = eina_thread_queue_new();
+   if (EINA_UNLIKELY(!_done_queue))
+     {
+        ERR("Failed to create thread queue");
+        return;
+     }
+
+   while (_threads_count < n)
+     {
+        Filter_Thread *th = &_threads[_threads_count];
+
+        th->queue = eina_thread_queue_new();
+        if (EINA_UNLIKELY(!th->queue))
+          {
+             ERR("Failed to create thread queue");
+             break;
+          }
+        if (!eina_thread_create(&th->thread, EINA_THREAD_NORMAL, -1,
+                                _filter_thread, th))
+          {
+             ERR("Failed to create filter thread");
+             eina_thread_queue_free(th->queue);
+             th->queue = NULL;
+             break;
+          }
+        _threads_count++;
+     }
+}
+
+static void
+_filter_threads_stop(void)
+{
+   Filter_Band_Msg *msg;
+   void *ref;
+   int i;
+
+   for (i = 0; i < _threads_count; i++)
+     {
+        msg = eina_thread_queue_send(_threads[i].queue, sizeof (Filter_Band_Msg), &ref);
+        msg->func = NULL;
+        eina_thread_queue_send_done(_threads[i].queue, ref);
+
+        msg = eina_thread_queue_wait(_done_queue, &ref);
+        if (msg) eina_thread_queue_wait_done(_done_queue, ref);
+
+        eina_thread_join(_threads[i].thread);
+        eina_thread_queue_free(_threads[i].queue);
+        _threads[i].queue = NULL;
+     }
+   if (_done_queue) eina_thread_queue_free(_done_queue);
+   _done_queue = NULL;
+   _threads_count = 0;
+   _started = EINA_FALSE;
+}
+
+static void
+_filter_threads_fork_reset(void *data EINA_UNUSED)
+{
+   int i;
+
+   // the threads did not survive the fork, start new ones on demand
+   for (i = 0; i < _threads_count; i++)
+     {
+        eina_thread_queue_free(_threads[i].queue);
+        _threads[i].queue = NULL;
+     }
+   if (_done_queue) eina_thread_queue_free(_done_queue);
+   _done_queue = NULL;
+   _threads_count = 0;
+   _started = EINA_FALSE;
+}
+
+void
+eng_filter_parallel_init(void)
+{
+   if (_inited) return;
+   if (!eina_lock_new(&_lock)) return;
+   ecore_fork_reset_callback_add(_filter_threads_fork_reset, NULL);
+   _inited = EINA_TRUE;
+}
+
+void
+eng_filter_parallel_shutdown(void)
+{
+   if (!_inited) return;
+   ecore_fork_reset_callback_del(_filter_threads_fork_reset, NULL);
+   _filter_threads_stop();
+   eina_lock_free(&_lock);
+   _inited = EINA_FALSE;
+}
+
+void
+eng_filter_parallel_run(Eng_Filter_Band_Func func, void *data, int len)
+{
+   Filter_Band_Msg *msg;
+   void *ref;
+   int i, n, band, start;
+
+   if ((!_inited) || (len < (2 * FILTER_BAND_MIN)) ||
+       (eina_lock_take_try(&_lock) != EINA_LOCK_SUCCEED))
+     {
+        func(data, 0, len);
+        return;
+     }
+
+   if (!_started) _filter_threads_start();
+   n = _threads_count + 1;
+   if (n > (len / FILTER_BAND_MIN)) n = len / FILTER_BAND_MIN;
+   if (n <= 1)
+     {
+        eina_lock_release(&_lock);
+        func(data, 0, len);
+        return;
+     }
+
+   // helpers get bands 1 to n-1, the first band is done right here
+   band = len / n;
+   for (i = 1, start = band; i < n; i++, start += band)
+     {
+        msg = eina_thread_queue_send(_threads[i - 1].queue, sizeof (Filter_Band_Msg), &ref);
+        msg->func = func;
+        msg->data = data;
+        msg->start = start;
+        msg->end = (i == (n - 1)) ? len : (start + band);
+        eina_thread_queue_send_done(_threads[i - 1].queue, ref);
+     }
+
+   func(data, 0, band);
+
+   for (i = 1; i < n; i++)
+     {
+        msg = eina_thread_queue_wait(_done_queue, &ref);
+        if (msg) eina_thread_queue_wait_done(_done_queue, ref);
+     }
+
+   eina_lock_release(&_lock);
+}
@@ -440,6 +440,79 @@ EFL_START_TEST(ecore_test_timer_recursion)
 }
 EFL_END_TEST
 
+static int sorted_last = -1;
+static int sorted_count = 0;
+
+static Eina_Bool
+_timer_sorted_cb(void *data)
+{
+   int slot = (intptr_t) data;
+
+   ck_assert_int_gt(slot, sorted_last);
+   sorted_last = slot;
+   if (++sorted_count == 64) ecore_main_loop_quit();
+   return ECORE_CALLBACK_CANCEL;
+}
+
+EFL_START_TEST(ecore_test_timer_sorted_insert)
+{
+   Ecore_Timer *timer;
+   int i, slot;
+
+   /* deadlines added out of order land on both sides of the list */
+   for (i = 0; i < 63; i++)
+     {
+        slot = (i * 37) % 63;
+        timer = ecore_timer_add(0.002 * (slot + 1), _timer_sorted_cb,
+                                (void *)(intptr_t) slot);
+        fail_if(timer == NULL);
+     }
+   /* and a delayed one moves from the head to the tail */
+   timer = ecore_timer_add(0.001, _timer_sorted_cb, (void *)(intptr_t) 63);
+   fail_if(timer == NULL);
+   ecore_timer_delay(timer, 0.2);
+
+   ecore_main_loop_begin();
+   ck_assert_int_eq(sorted_count, 64);
+}
+EFL_END_TEST
+
+static int equal_last = -1;
+static int equal_count = 0;
+
+static Eina_Bool
+_timer_equal_cb(void *data)
+{
+   int slot = (intptr_t) data;
+
+   ck_assert_int_eq(slot, equal_last + 1);
+   equal_last = slot;
+   if (++equal_count == 9) ecore_main_loop_quit();
+   return ECORE_CALLBACK_CANCEL;
+}
+
+EFL_START_TEST(ecore_test_timer_equal_in_order)
+{
+   Ecore_Timer *timer;
+   int i;
+
+   /* a later deadline at the tail makes equal ones walk from the head,
+    * they must still expire in the order they were added */
+   timer = ecore_timer_add(0.001, _timer_equal_cb, (void *)(intptr_t) 0);
+   fail_if(timer == NULL);
+   timer = ecore_timer_add(0.05, _timer_equal_cb, (void *)(intptr_t) 8);
+   fail_if(timer == NULL);
+   for (i = 1; i < 8; i++)
+     {
+        timer = ecore_timer_add(0.001, _timer_equal_cb, (void *)(intptr_t) i);
+        fail_if(timer == NULL);
+     }
+
+   ecore_main_loop_begin();
+   ck_assert_int_eq(equal_count, 9);
+}
+EFL_END_TEST
+
 void ecore_test_timer(TCase *tc)
 {
   tcase_add_test(tc, ecore_test_timers);
@@ -449,4 +522,6 @@ void ecore_test_timer(TCase *tc)
   tcase_add_test(tc, ecore_test_timer_in_order);
   tcase_add_test(tc, ecore_test_timer_iteration);
   tcase_add_test(tc, ecore_test_timer_recursion);
+  tcase_add_test(tc, ecore_test_timer_sorted_insert);
+  tcase_add_test(tc, ecore_test_timer_equal_in_order);
 }
@@ -216,6 +216,33 @@ EFL_START_TEST(edje_test_color_class)
 }
 EFL_END_TEST
 
+EFL_START_TEST(edje_test_custom_state_rel_to)
+{
+   int x, y, w, h;
+   Evas *evas = _setup_evas();
+   Evas_Object *obj;
+
+   obj = edje_object_add(evas);
+   fail_unless(edje_object_file_set(obj, test_layout_get("test_custom_state.edj"), "test_group"));
+   evas_object_resize(obj, 200, 200);
+
+   edje_object_part_geometry_get(obj, "follower", &x, &y, &w, &h);
+   ck_assert(x == 150 && y == 0 && w == 50 && h == 50);
+
+   /* a custom state moves the follower onto another part */
+   edje_object_signal_emit(obj, "custom", "");
+   edje_object_message_signal_process(obj);
+   edje_object_part_geometry_get(obj, "follower", &x, &y, &w, &h);
+   ck_assert(x == 0 && y == 0 && w == 50 && h == 50);
+
+   /* and it has to follow that part from now on */
+   edje_object_signal_emit(obj, "move", "");
+   edje_object_message_signal_process(obj);
+   edje_object_part_geometry_get(obj, "follower", &x, &y, &w, &h);
+   ck_assert(x == 100 && y == 100 && w == 50 && h == 50);
+}
+EFL_END_TEST
+
 void edje_test_features(TCase *tc)
 {
    tcase_add_test(tc, edje_test_masking);
@@ -223,4 +250,5 @@ void edje_test_features(TCase *tc)
    tcase_add_test(tc, edje_test_snapshot);
    tcase_add_test(tc, edje_test_size_class);
    tcase_add_test(tc, edje_test_color_class);
+   tcase_add_test(tc, edje_test_custom_state_rel_to);
 }
@@ -229,11 +229,157 @@ EFL_START_TEST(edje_test_signal_callback_del_full)
 }
 EFL_END_TEST
 
+EFL_START_TEST(edje_test_signal_callback_glob)
+{
+   Evas *evas;
+   Evas_Object *obj;
+   int data[5] = { 1, 2, 4, 8, 16 };
+
+   evas = _setup_evas();
+
+   obj = efl_add(EFL_CANVAS_LAYOUT_CLASS, evas,
+                 efl_file_set(efl_added,
+                 test_layout_get("test_signal_callback_del_full.edj")),
+                 efl_file_key_set(efl_added, "test"),
+                 efl_gfx_entity_size_set(efl_added, EINA_SIZE2D(320, 240)),
+                 efl_gfx_entity_visible_set(efl_added, 1));
+
+   edje_object_signal_callback_add(obj, "some_*", "event", _signal_callback_count_cb, &data[0]);
+   edje_object_signal_callback_add(obj, "*signal", "ev?nt", _signal_callback_count_cb, &data[1]);
+   edje_object_signal_callback_add(obj, "[!a-r]ome_sig*", "*", _signal_callback_count_cb, &data[2]);
+   edje_object_signal_callback_add(obj, "some_signal*?", "*", _signal_callback_count_cb, &data[3]);
+   edje_object_signal_callback_add(obj, "*", "[a-d]*", _signal_callback_count_cb, &data[4]);
+
+   _signal_count = 0;
+   edje_object_signal_emit(obj, "some_signal", "event");
+   edje_object_message_signal_process(obj);
+   ck_assert_int_eq(_signal_count, (data[0] + data[1] + data[2]));
+
+   /* Same emission again goes through the already built transitions. */
+   _signal_count = 0;
+   edje_object_signal_emit(obj, "some_signal", "event");
+   edje_object_message_signal_process(obj);
+   ck_assert_int_eq(_signal_count, (data[0] + data[1] + data[2]));
+
+   _signal_count = 0;
+   edje_object_signal_emit(obj, "some_signal2", "bevent");
+   edje_object_message_signal_process(obj);
+   ck_assert_int_eq(_signal_count, (data[2] + data[3] + data[4]));
+
+   _signal_count = 0;
+   edje_object_signal_emit(obj, "rome_signal", "event");
+   edje_object_message_signal_process(obj);
+   ck_assert_int_eq(_signal_count, data[1]);
+
+   efl_del(obj);
+}
+EFL_END_TEST
+
+static int _signal_order[8];
+static int _signal_order_count;
+
+static void
+_signal_callback_order_cb(void *data, Evas_Object *obj EINA_UNUSED,
+                          const char *emission EINA_UNUSED, const char *source EINA_UNUSED)
+{
+   ck_assert_int_lt(_signal_order_count, 8);
+   _signal_order[_signal_order_count++] = *(int *)data;
+}
+
+EFL_START_TEST(edje_test_signal_callback_order)
+{
+   Evas *evas;
+   Evas_Object *obj;
+   int data[5] = { 0, 1, 2, 3, 4 };
+   int i, pass;
+
+   evas = _setup_evas();
+
+   obj = efl_add(EFL_CANVAS_LAYOUT_CLASS, evas,
+                 efl_file_set(efl_added,
+                 test_layout_get("test_signal_callback_del_full.edj")),
+                 efl_file_key_set(efl_added, "test"),
+                 efl_gfx_entity_size_set(efl_added, EINA_SIZE2D(320, 240)),
+                 efl_gfx_entity_visible_set(efl_added, 1));
+
+   /* Plain strings come after patterns, each in the order they were added,
+    * however the patterns overlap. */
+   edje_object_signal_callback_add(obj, "some_signal", "event", _signal_callback_order_cb, &data[4]);
+   edje_object_signal_callback_add(obj, "*signal", "event", _signal_callback_order_cb, &data[0]);
+   edje_object_signal_callback_add(obj, "some_[s]ignal", "event", _signal_callback_order_cb, &data[1]);
+   edje_object_signal_callback_add(obj, "some_*", "*", _signal_callback_order_cb, &data[2]);
+   edje_object_signal_callback_add(obj, "*", "ev?nt", _signal_callback_order_cb, &data[3]);
+
+   /* The second pass goes through the already built transitions. */
+   for (pass = 0; pass < 2; pass++)
+     {
+        _signal_order_count = 0;
+        edje_object_signal_emit(obj, "some_signal", "event");
+        edje_object_message_signal_process(obj);
+        ck_assert_int_eq(_signal_order_count, 5);
+        for (i = 0; i < 5; i++)
+          ck_assert_int_eq(_signal_order[i], i);
+     }
+
+   efl_del(obj);
+}
+EFL_END_TEST
+
+EFL_START_TEST(edje_test_signal_coalesce)
+{
+   Evas *evas;
+   Evas_Object *obj;
+   int data = 1;
+
+   evas = _setup_evas();
+
+   obj = efl_add(EFL_CANVAS_LAYOUT_CLASS, evas,
+                 efl_file_set(efl_added,
+                 test_layout_get("test_signal_callback_del_full.edj")),
+                 efl_file_key_set(efl_added, "test"),
+                 efl_gfx_entity_size_set(efl_added, EINA_SIZE2D(320, 240)),
+                 efl_gfx_entity_visible_set(efl_added, 1));
+
+   edje_object_signal_callback_add(obj, "*", "event", _signal_callback_count_cb, &data);
+
+   /* Off by default, every send is delivered. */
+   ck_assert_int_eq(edje_message_coalesce_get(), EINA_FALSE);
+   _signal_count = 0;
+   edje_object_signal_emit(obj, "some_signal", "event");
+   edje_object_signal_emit(obj, "some_signal", "event");
+   edje_object_message_signal_process(obj);
+   ck_assert_int_eq(_signal_count, 2);
+
+   edje_message_coalesce_set(EINA_TRUE);
+
+   /* The same signal queued twice in a row is delivered once. */
+   _signal_count = 0;
+   edje_object_signal_emit(obj, "some_signal", "event");
+   edje_object_signal_emit(obj, "some_signal", "event");
+   edje_object_message_signal_process(obj);
+   ck_assert_int_eq(_signal_count, 1);
+
+   /* Anything in between keeps both. */
+   _signal_count = 0;
+   edje_object_signal_emit(obj, "some_signal", "event");
+   edje_object_signal_emit(obj, "other_signal", "event");
+   edje_object_signal_emit(obj, "some_signal", "event");
+   edje_object_message_signal_process(obj);
+   ck_assert_int_eq(_signal_count, 3);
+
+   edje_message_coalesce_set(EINA_FALSE);
+   efl_del(obj);
+}
+EFL_END_TEST
+
 void edje_test_signal(TCase *tc)
 {
    tcase_add_test(tc, edje_test_message_send_legacy);
    tcase_add_test(tc, edje_test_message_send_eo);
    tcase_add_test(tc, edje_test_signals);
    tcase_add_test(tc, edje_test_signal_callback_del_full);
+   tcase_add_test(tc, edje_test_signal_callback_glob);
+   tcase_add_test(tc, edje_test_signal_callback_order);
+   tcase_add_test(tc, edje_test_signal_coalesce);
 
 }
@@ -2,10 +2,51 @@
 # include <config.h>
 #endif
 
+#include <Eina.h>
+#include <Eet.h>
+
+#define EFREET_MODULE_LOG_DOM /* no logging in this file */
+
 #include <Efreet.h>
+#include "efreet_private.h"
+#include "efreet_cache_private.h"
 
 #include "efreet_suite.h"
 
+/* header of the icon index: magic, buckets count, records offset, strings
+ * offset, total size */
+#define INDEX_STRINGS (3 * sizeof(unsigned int))
+#define INDEX_TOTAL (4 * sizeof(unsigned int))
+#define INDEX_HEADER_SIZE (5 * sizeof(unsigned int))
+
+static void
+_icon_free(Efreet_Cache_Icon *icon)
+{
+   unsigned int i;
+
+   for (i = 0; i < icon->icons_count; i++)
+     {
+        free(icon->icons[i]->paths);
+        free(icon->icons[i]);
+     }
+   free(icon->icons);
+   free(icon);
+}
+
+static void
+_index_uint_set(char *index, size_t off, unsigned int v)
+{
+   memcpy(index + off, &v, sizeof(v));
+}
+
+static unsigned int
+_index_uint_get(const char *index, size_t off)
+{
+   unsigned int v;
+
+   memcpy(&v, index + off, sizeof(v));
+   return v;
+}
 
 EFL_START_TEST(efreet_test_efreet_cache_init)
 {
@@ -13,7 +54,84 @@ EFL_START_TEST(efreet_test_efreet_cache_init)
 }
 EFL_END_TEST
 
+EFL_START_TEST(efreet_test_efreet_cache_icon_index)
+{
+   const char *paths[] = { "/usr/share/icons/test/16x16/test-icon.png",
+                           "/usr/share/icons/test/16x16/test-icon.svg" };
+   Efreet_Cache_Icon_Element elem = { 0 };
+   Efreet_Cache_Icon_Element *elems[] = { &elem };
+   Efreet_Cache_Icon icon = { 0 };
+   Efreet_Cache_Icon *found;
+   Eina_Hash *icons;
+   Eina_Bool corrupt;
+   char *index, *truncated;
+   int size, len;
+
+   elem.paths = paths;
+   elem.paths_count = 2;
+   elem.normal = elem.min = elem.max = 16;
+   icon.theme = "test";
+   icon.icons = elems;
+   icon.icons_count = 1;
+
+   icons = eina_hash_string_superfast_new(NULL);
+   eina_hash_add(icons, "test-icon", &icon);
+   index = efreet_icon_cache_index_build(icons, &size);
+   eina_hash_free(icons);
+   fail_if(!index);
+   fail_if(!efreet_icon_cache_index_valid(index, size));
+
+   found = efreet_icon_cache_index_find(index, "test-icon", &corrupt);
+   fail_if(corrupt);
+   fail_if(!found);
+   ck_assert_str_eq(found->theme, "test");
+   ck_assert_int_eq(found->icons_count, 1);
+   ck_assert_int_eq(found->icons[0]->paths_count, 2);
+   ck_assert_str_eq(found->icons[0]->paths[1], paths[1]);
+   _icon_free(found);
+
+   fail_if(efreet_icon_cache_index_find(index, "other-icon", &corrupt));
+   fail_if(corrupt);
+
+   /* A short read does not match the size in the header */
+   fail_if(efreet_icon_cache_index_valid(index, size - 1));
+
+   /* Cut the index at every length with a header patched to match, the
+    * lookup must notice it without reading past the end. */
+   for (len = INDEX_HEADER_SIZE; len < size; len++)
+     {
+        truncated = malloc(len);
+        fail_if(!truncated);
+        memcpy(truncated, index, len);
+        _index_uint_set(truncated, INDEX_TOTAL, len);
+        if (_index_uint_get(truncated, INDEX_STRINGS) > (unsigned int)len)
+          _index_uint_set(truncated, INDEX_STRINGS, len);
+
+        if (efreet_icon_cache_index_valid(truncated, len))
+          {
+             found = efreet_icon_cache_index_find(truncated, "test-icon", &corrupt);
+             fail_if(found);
+             fail_if(!corrupt);
+          }
+        free(truncated);
+     }
+
+   /* Offsets pointing out of their table */
+   truncated = malloc(size);
+   fail_if(!truncated);
+   memcpy(truncated, index, size);
+   _index_uint_set(truncated, INDEX_STRINGS, size);
+   fail_if(!efreet_icon_cache_index_valid(truncated, size));
+   fail_if(efreet_icon_cache_index_find(truncated, "test-icon", &corrupt));
+   fail_if(!corrupt);
+   free(truncated);
+
+   free(index);
+}
+EFL_END_TEST
+
 void efreet_test_efreet_cache(TCase *tc)
 {
    tcase_add_test(tc, efreet_test_efreet_cache_init);
+   tcase_add_test(tc, efreet_test_efreet_cache_icon_index);
 }
@@ -8,7 +8,10 @@
 #include <Eio.h>
 #include <Ecore.h>
 #include <Efl.h>
+#include <Ecore_File.h>
 #include <stdio.h>
+#include <unistd.h>
+#include <sys/stat.h>
 
 #include "eio_suite.h"
 
@@ -188,8 +191,272 @@ EFL_START_TEST(efl_io_model_test_test_monitor_add)
 }
 EFL_END_TEST
 
+static Eina_Bool
+_timeout_cb(void *data)
+{
+   Eina_Bool *timeout = data;
+
+   *timeout = EINA_TRUE;
+   ecore_main_loop_quit();
+   return ECORE_CALLBACK_CANCEL;
+}
+
+static void
+_event_quit_cb(void *data, const Efl_Event *event)
+{
+   Efl_Model_Children_Event *evt = event->info;
+   unsigned int *index = data;
+
+   if (index && evt) *index = evt->index;
+   ecore_main_loop_quit();
+}
+
+static Eina_Bool
+_threads_idle_cb(void *data)
+{
+   int *idle = data;
+
+   // The end callback runs on the main loop after the worker is done
+   if (ecore_thread_active_get() || ecore_thread_pending_get())
+     *idle = 0;
+   else if (++(*idle) > 2)
+     {
+        ecore_main_loop_quit();
+        return ECORE_CALLBACK_CANCEL;
+     }
+   return ECORE_CALLBACK_RENEW;
+}
+
+static void
+_threads_idle_wait(void)
+{
+   int idle = 0;
+
+   ecore_timer_add(0.05, _threads_idle_cb, &idle);
+   ecore_main_loop_begin();
+}
+
+static void
+_wait_for_event(Eo *obj, const Efl_Event_Description *desc, unsigned int *index)
+{
+   Ecore_Timer *timer;
+   Eina_Bool timeout = EINA_FALSE;
+
+   timer = ecore_timer_add(5.0, _timeout_cb, &timeout);
+   efl_event_callback_add(obj, desc, _event_quit_cb, index);
+   ecore_main_loop_begin();
+   efl_event_callback_del(obj, desc, _event_quit_cb, index);
+   if (!timeout) ecore_timer_del(timer);
+
+   fail_if(timeout);
+}
+
+static Eina_Value
+_child_keep(void *data, const Eina_Value v,
+            const Eina_Future *dead_future EINA_UNUSED)
+{
+   Eo **child = data;
+
+   fail_if(eina_value_type_get(&v) != EINA_VALUE_TYPE_ARRAY);
+   fail_if(!eina_value_array_get(&v, 0, child));
+   efl_ref(*child);
+   ecore_main_loop_quit();
+
+   return v;
+}
+
+static Eo *
+_child_get(Eo *model, unsigned int index)
+{
+   Eo *child = NULL;
+
+   eina_future_then(efl_model_children_slice_get(model, index, 1),
+                    _child_keep, &child, NULL);
+   ecore_main_loop_begin();
+   fail_if(!child);
+
+   return child;
+}
+
+// Only get the parent to stat the child in batch, the child object
+// itself is gone by the time the batch comes back.
+static void
+_child_batch_stat(Eo *model, unsigned int index)
+{
+   eina_future_cancel(efl_model_children_slice_get(model, index, 1));
+   _threads_idle_wait();
+}
+
+static void
+_file_write(const char *path, size_t length)
+{
+   char buf[32] = { 0 };
+   FILE *f;
+
+   fail_if(length > sizeof (buf));
+   f = fopen(path, "wb");
+   fail_if(!f);
+   fail_if(fwrite(buf, 1, length, f) != length);
+   fclose(f);
+}
+
+static unsigned long
+_child_size_get(Eo *child)
+{
+   unsigned long size = 0;
+   Eina_Value *v;
+
+   v = efl_model_property_get(child, "size");
+   if (eina_value_type_get(v) == EINA_VALUE_TYPE_ERROR)
+     {
+        eina_value_free(v);
+        _wait_for_event(child, EFL_MODEL_EVENT_PROPERTIES_CHANGED, NULL);
+        v = efl_model_property_get(child, "size");
+     }
+   fail_if(!eina_value_ulong_get(v, &size));
+   eina_value_free(v);
+
+   return size;
+}
+
+EFL_START_TEST(efl_io_model_test_test_monitor_unknown_dir)
+{
+   Eina_Tmpstr *dirname;
+   Eina_Stringshare *sub, *inner;
+   Eo *filemodel, *child;
+   unsigned int index = 0;
+
+   fail_if(!eina_file_mkdtemp("EflIoModelXXXXXX", &dirname));
+   sub = eina_stringshare_printf("%s/sub", dirname);
+   inner = eina_stringshare_printf("%s/sub/inner", dirname);
+
+   filemodel = efl_add(EFL_IO_MODEL_CLASS, efl_main_loop_get(),
+                       efl_io_model_path_set(efl_added, dirname));
+   fail_if(!filemodel);
+
+   // Wait for the empty listing, the monitor is up by then
+   efl_model_children_count_get(filemodel);
+   _wait_for_event(filemodel, EFL_MODEL_EVENT_CHILDREN_COUNT_CHANGED, NULL);
+
+   // Entries coming from the monitor have an unknown type
+   fail_if(mkdir(sub, 0755) != 0);
+   _wait_for_event(filemodel, EFL_MODEL_EVENT_CHILD_ADDED, &index);
+
+   _child_batch_stat(filemodel, index);
+   _file_write(inner, 1);
+
+   // The batched stat must be enough to list it as a directory
+   child = _child_get(filemodel, index);
+   efl_model_children_count_get(child);
+   _wait_for_event(child, EFL_MODEL_EVENT_CHILDREN_COUNT_CHANGED, NULL);
+   ck_assert_int_eq(efl_model_children_count_get(child), 1);
+
+   efl_unref(child);
+   efl_del(filemodel);
+
+   ecore_file_recursive_rm(dirname);
+   eina_stringshare_del(inner);
+   eina_stringshare_del(sub);
+   eina_tmpstr_del(dirname);
+}
+EFL_END_TEST
+
+EFL_START_TEST(efl_io_model_test_test_monitor_recreate)
+{
+   Eina_Tmpstr *dirname;
+   Eina_Stringshare *file;
+   Eo *filemodel, *child;
+   unsigned int index = 0;
+
+   fail_if(!eina_file_mkdtemp("EflIoModelXXXXXX", &dirname));
+   file = eina_stringshare_printf("%s/file", dirname);
+   _file_write(file, 1);
+
+   filemodel = efl_add(EFL_IO_MODEL_CLASS, efl_main_loop_get(),
+                       efl_io_model_path_set(efl_added, dirname));
+   fail_if(!filemodel);
+
+   efl_model_children_count_get(filemodel);
+   _wait_for_event(filemodel, EFL_MODEL_EVENT_CHILDREN_COUNT_CHANGED, NULL);
+   ck_assert_int_eq(efl_model_children_count_get(filemodel), 1);
+
+   // Cache a stat for it, then recreate it under the same path
+   _child_batch_stat(filemodel, 0);
+   fail_if(unlink(file) != 0);
+   _wait_for_event(filemodel, EFL_MODEL_EVENT_CHILD_REMOVED, NULL);
+   _file_write(file, 10);
+   _wait_for_event(filemodel, EFL_MODEL_EVENT_CHILD_ADDED, &index);
+   _threads_idle_wait();
+
+   child = _child_get(filemodel, index);
+   ck_assert_int_eq(_child_size_get(child), 10);
+
+   efl_unref(child);
+   efl_del(filemodel);
+
+   ecore_file_recursive_rm(dirname);
+   eina_stringshare_del(file);
+   eina_tmpstr_del(dirname);
+}
+EFL_END_TEST
+
+static Eina_Bool
+_monitor_quit_cb(void *data EINA_UNUSED, int type EINA_UNUSED, void *event EINA_UNUSED)
+{
+   ecore_main_loop_quit();
+   return ECORE_CALLBACK_PASS_ON;
+}
+
+EFL_START_TEST(efl_io_model_test_test_monitor_modified)
+{
+   Eina_Tmpstr *dirname;
+   Eina_Stringshare *file;
+   Ecore_Event_Handler *handler;
+   Ecore_Timer *timer;
+   Eina_Bool timeout = EINA_FALSE;
+   Eo *filemodel, *child;
+
+   fail_if(!eina_file_mkdtemp("EflIoModelXXXXXX", &dirname));
+   file = eina_stringshare_printf("%s/file", dirname);
+   _file_write(file, 1);
+
+   filemodel = efl_add(EFL_IO_MODEL_CLASS, efl_main_loop_get(),
+                       efl_io_model_path_set(efl_added, dirname));
+   fail_if(!filemodel);
+
+   efl_model_children_count_get(filemodel);
+   _wait_for_event(filemodel, EFL_MODEL_EVENT_CHILDREN_COUNT_CHANGED, NULL);
+   ck_assert_int_eq(efl_model_children_count_get(filemodel), 1);
+
+   // Cache a stat for it, then change it behind the model's back
+   _child_batch_stat(filemodel, 0);
+   // Added after the model's own handler, so it runs after it
+   handler = ecore_event_handler_add(EIO_MONITOR_FILE_MODIFIED, _monitor_quit_cb, NULL);
+   timer = ecore_timer_add(5.0, _timeout_cb, &timeout);
+   _file_write(file, 10);
+   ecore_main_loop_begin();
+   ecore_event_handler_del(handler);
+   if (!timeout) ecore_timer_del(timer);
+   fail_if(timeout);
+
+   // A new object must not be built from the stat cached before the change
+   child = _child_get(filemodel, 0);
+   ck_assert_int_eq(_child_size_get(child), 10);
+
+   efl_unref(child);
+   efl_del(filemodel);
+
+   ecore_file_recursive_rm(dirname);
+   eina_stringshare_del(file);
+   eina_tmpstr_del(dirname);
+}
+EFL_END_TEST
+
 void
 efl_io_model_test_monitor_add(TCase *tc)
 {
    tcase_add_test(tc, efl_io_model_test_test_monitor_add);
+   tcase_add_test(tc, efl_io_model_test_test_monitor_unknown_dir);
+   tcase_add_test(tc, efl_io_model_test_test_monitor_recreate);
+   tcase_add_test(tc, efl_io_model_test_test_monitor_modified);
 }
@@ -1590,6 +1590,145 @@ EFL_START_TEST(utc_eldbus_hello_p)
 }
 EFL_END_TEST
 
+static const unsigned char fixed_bytes[] = { 0, 1, 127, 128, 255 };
+
+static Eina_Bool
+_fixed_array_check(const Eina_Value *st, const char *member, Eina_Bool bytes)
+{
+   Eina_Value array;
+   unsigned int i, count;
+   Eina_Bool ret = EINA_TRUE;
+
+   if (!eina_value_struct_value_get(st, member, &array)) return EINA_FALSE;
+   count = bytes ? EINA_C_ARRAY_LENGTH(fixed_bytes) : EINA_C_ARRAY_LENGTH(numbers_int);
+   if (eina_value_array_count(&array) != count) ret = EINA_FALSE;
+   for (i = 0; ret && (i < count); i++)
+     {
+        if (bytes)
+          {
+             unsigned char b;
+             eina_value_array_get(&array, i, &b);
+             if (b != fixed_bytes[i]) ret = EINA_FALSE;
+          }
+        else
+          {
+             int n;
+             eina_value_array_get(&array, i, &n);
+             if (n != (int)numbers_int[i]) ret = EINA_FALSE;
+          }
+     }
+   eina_value_flush(&array);
+   return ret;
+}
+
+static void
+_fixed_array_signal_cb(void *data EINA_UNUSED, const Eldbus_Message *msg)
+{
+   Eina_Value *value;
+
+   if (timeout != NULL)
+     {
+        ecore_timer_del(timeout);
+        timeout = NULL;
+     }
+
+   value = eldbus_message_to_eina_value(msg);
+   if (value)
+     {
+        is_success = _fixed_array_check(value, "arg0", EINA_FALSE) &&
+           _fixed_array_check(value, "arg1", EINA_TRUE);
+        eina_value_free(value);
+     }
+
+   ecore_main_loop_quit();
+}
+
+/**
+ * @addtogroup eldbus_message
+ * @{
+ * @defgroup eldbus_message_fixed_array_eina_value
+ * @li eldbus_message_from_eina_value()
+ * @li eldbus_message_to_eina_value()
+ * @{
+ * @objective Positive test case checks that arrays of fixed size types
+ * survive a round trip through eina value and a signal.
+ *
+ * @n Input Data:
+ * @li the conn object connection with bus
+ *
+ * @procedure
+ * @step 1 Call eldbus_connection_get function to get connection object
+ * @step 2 Add a signal handler converting the received signal to eina value.
+ * @step 3 Fill a signal with an "ai" and an "ay" array from eina value.
+ * @step 4 Send the signal and start the main loop.
+ * @step 5 Check the arrays received in the handler.
+ * @step 6 Free the signal handler and the connection.
+ *
+ * @passcondition Both arrays are received unchanged, and there is no segmentation fault.
+ * @}
+ * @}
+ */
+EFL_START_TEST(utc_eldbus_message_fixed_array_eina_value_p)
+{
+   Eina_Value_Struct_Member members[] = {
+      {"numbers", EINA_VALUE_TYPE_ARRAY, 0},
+      {"bytes", EINA_VALUE_TYPE_ARRAY, sizeof(Eina_Value_Array)}
+   };
+   Eina_Value_Struct_Desc desc_struct = {
+         EINA_VALUE_STRUCT_DESC_VERSION,
+         NULL,
+         members,
+         2,
+         2 * sizeof(Eina_Value_Array)
+   };
+   Eina_Value *st, *numbers, *bytes;
+   unsigned int i;
+
+   is_success = EINA_FALSE;
+
+   Eldbus_Connection *conn = eldbus_connection_get(ELDBUS_CONNECTION_TYPE_SESSION);
+   ck_assert_ptr_ne(NULL, conn);
+
+   Eldbus_Signal_Handler *signal_handler =
+      eldbus_signal_handler_add(conn, NULL, dbus_session_path, interface_session,
+                                "FixedArrays", _fixed_array_signal_cb, NULL);
+   ck_assert_ptr_ne(NULL, signal_handler);
+
+   numbers = eina_value_array_new(EINA_VALUE_TYPE_INT, 0);
+   for (i = 0; i < EINA_C_ARRAY_LENGTH(numbers_int); i++)
+     eina_value_array_append(numbers, (int)numbers_int[i]);
+   bytes = eina_value_array_new(EINA_VALUE_TYPE_UCHAR, 0);
+   for (i = 0; i < EINA_C_ARRAY_LENGTH(fixed_bytes); i++)
+     eina_value_array_append(bytes, fixed_bytes[i]);
+
+   st = eina_value_struct_new(&desc_struct);
+   eina_value_struct_value_set(st, "numbers", numbers);
+   eina_value_struct_value_set(st, "bytes", bytes);
+
+   Eldbus_Message *msg = eldbus_message_signal_new(dbus_session_path, interface_session,
+                                                   "FixedArrays");
+   ck_assert_ptr_ne(NULL, msg);
+   ck_assert(eldbus_message_from_eina_value("aiay", msg, st));
+
+   eina_value_free(numbers);
+   eina_value_free(bytes);
+   eina_value_free(st);
+
+   /* signals get no reply, so there is no pending to check */
+   eldbus_connection_send(conn, msg, NULL, NULL, -1);
+
+   timeout = ecore_timer_add(0.1, _ecore_loop_close, NULL);
+   ck_assert_ptr_ne(NULL, timeout);
+
+   ecore_main_loop_begin();
+
+   ck_assert_msg(is_success, "Fixed arrays did not survive the round trip");
+
+   eldbus_signal_handler_del(signal_handler);
+   eldbus_connection_unref(conn);
+}
+EFL_END_TEST
+
 void eldbus_test_eldbus_message(TCase *tc)
 {
    tcase_add_test(tc, utc_eldbus_message_iterator_activatable_list_p);
@@ -1605,5 +1744,6 @@ void eldbus_test_eldbus_message(TCase *tc)
    tcase_add_test(tc, utc_eldbus_message_error_new_p);
    tcase_add_test(tc, utc_eldbus_message_iter_del_p);
    tcase_add_test(tc, utc_eldbus_message_iter_fixed_array_get_p);
+   tcase_add_test(tc, utc_eldbus_message_fixed_array_eina_value_p);
    tcase_add_test(tc, utc_eldbus_hello_p);
 }
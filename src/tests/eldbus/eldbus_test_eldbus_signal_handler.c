@@ -445,6 +445,98 @@ EFL_START_TEST(utc_eldbus_signal_handler_free_cb_add_del_p)
 }
 EFL_END_TEST
 
+static char dispatch_order[16];
+
+static void
+_signal_dispatch_order_cb(void *data, const Eldbus_Message *msg)
+{
+   size_t len = strlen(dispatch_order);
+
+   /* the interface only handler also sees the bus' own signals */
+   if (strcmp(eldbus_message_member_get(msg), signal_name)) return;
+   if (len < sizeof(dispatch_order) - 1)
+     {
+        dispatch_order[len] = *(const char *)data;
+        dispatch_order[len + 1] = '\0';
+     }
+}
+
+static void
+_signal_dispatch_last_cb(void *data, const Eldbus_Message *msg)
+{
+   _signal_dispatch_order_cb(data, msg);
+
+   if (timeout != NULL)
+     {
+        ecore_timer_del(timeout);
+        timeout = NULL;
+     }
+   ecore_main_loop_quit();
+}
+
+/**
+ * @addtogroup eldbus_signal_handler
+ * @{
+ * @defgroup eldbus_signal_handler_dispatch signal dispatch
+ * @{
+ * @objective Positive test case checks that a signal reaches every matching
+ * handler in the order they were added, whether they match on the path,
+ * on the member only or on neither, and that handlers for other paths are skipped.
+ *
+ * @procedure
+ * @step 1 Get eldbus connection object and check on NULL
+ * @step 2 Add handlers matching on interface only, on another path,
+ * on member only and on path, interface and member.
+ * @step 3 Send the signal and run the main loop until the last handler is called.
+ * @step 4 Check the order the handlers were called in.
+ * @step 5 Delete the handlers and the connection.
+ *
+ * @passcondition Handlers 1, 3 and 4 are called in that order, handler 2 is not.
+ * @}
+ * @}
+ */
+EFL_START_TEST(utc_eldbus_signal_handler_dispatch_p)
+{
+   static const char ids[] = "1234";
+   Eldbus_Signal_Handler *handlers[4];
+   unsigned int i;
+
+   dispatch_order[0] = '\0';
+
+   Eldbus_Connection *conn = eldbus_connection_get(ELDBUS_CONNECTION_TYPE_SESSION);
+   ck_assert_ptr_ne(NULL, conn);
+
+   handlers[0] = eldbus_signal_handler_add(conn, NULL, NULL, interface, NULL,
+                                           _signal_dispatch_order_cb, ids + 0);
+   handlers[1] = eldbus_signal_handler_add(conn, NULL, "/org/freedesktop/DBus/Other",
+                                           interface, signal_name,
+                                           _signal_dispatch_order_cb, ids + 1);
+   handlers[2] = eldbus_signal_handler_add(conn, NULL, NULL, NULL, signal_name,
+                                           _signal_dispatch_order_cb, ids + 2);
+   handlers[3] = eldbus_signal_handler_add(conn, NULL, path, interface, signal_name,
+                                           _signal_dispatch_last_cb, ids + 3);
+   for (i = 0; i < EINA_C_ARRAY_LENGTH(handlers); i++)
+     ck_assert_ptr_ne(NULL, handlers[i]);
+
+   Eldbus_Message *msg = eldbus_message_signal_new(path, interface, signal_name);
+   ck_assert_ptr_ne(NULL, msg);
+
+   Eldbus_Pending *pending = eldbus_connection_send(conn, msg, _response_message_cb, NULL, -1);
+   ck_assert_ptr_ne(NULL, pending);
+
+   timeout = ecore_timer_add(0.1, _ecore_loop_close, NULL);
+   ck_assert_ptr_ne(NULL, timeout);
+
+   ecore_main_loop_begin();
+
+   ck_assert_str_eq(dispatch_order, "134");
+
+   for (i = 0; i < EINA_C_ARRAY_LENGTH(handlers); i++)
+     eldbus_signal_handler_del(handlers[i]);
+   eldbus_connection_unref(conn);
+}
+EFL_END_TEST
+
 /**
  *@}
  */
@@ -456,4 +548,5 @@ eldbus_test_eldbus_signal_handler(TCase *tc)
    tcase_add_test(tc, utc_eldbus_signal_handler_get_p);
    tcase_add_test(tc, utc_eldbus_signal_handler_ref_unref_p);
    tcase_add_test(tc, utc_eldbus_signal_handler_free_cb_add_del_p);
+   tcase_add_test(tc, utc_eldbus_signal_handler_dispatch_p);
 }
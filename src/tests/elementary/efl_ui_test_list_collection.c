@@ -305,6 +305,64 @@ EFL_START_TEST(placement_test_group_crazy)
 }
 EFL_END_TEST
 
+EFL_START_TEST(placement_test_size_change)
+{
+   Eo *item[20];
+   Eina_Rect r;
+   int y[] = { 0, 40, 80, 140 };
+
+   for (int i = 0; i < 20; ++i)
+     {
+        item[i] = efl_add(EFL_UI_LIST_DEFAULT_ITEM_CLASS, item_container);
+        efl_pack_end(item_container, item[i]);
+        efl_gfx_hint_size_min_set(item[i], EINA_SIZE2D(40, 40));
+     }
+
+   efl_gfx_entity_geometry_set(win, EINA_RECT(0, 0, 200, 200));
+
+   get_me_to_those_events(item_container);
+
+   //grow a range in the middle, only the items after it move
+   for (int i = 2; i < 5; ++i)
+     efl_gfx_hint_size_min_set(item[i], EINA_SIZE2D(40, 60));
+
+   get_me_to_those_events(item_container);
+
+   for (int i = 0; i < 4; ++i)
+     {
+        r = efl_gfx_entity_geometry_get(item[i]);
+
+        ck_assert_int_eq(r.x, 0);
+        ck_assert_int_eq(r.y, y[i]);
+        ck_assert_int_eq(r.w, 200);
+        ck_assert_int_eq(r.h, (i < 2) ? 40 : 60);
+        ck_assert_int_eq(efl_gfx_entity_visible_get(item[i]), EINA_TRUE);
+     }
+   ck_assert_int_eq(efl_gfx_entity_visible_get(item[10]), EINA_FALSE);
+
+   //shrink a single one and scroll past the changed range
+   efl_gfx_hint_size_min_set(item[3], EINA_SIZE2D(40, 20));
+
+   get_me_to_those_events(item_container);
+
+   efl_ui_scrollable_content_pos_set(item_container, EINA_POSITION2D(0, 160));
+
+   r = efl_gfx_entity_geometry_get(item[4]);
+   ck_assert_int_eq(r.y, 0);
+   ck_assert_int_eq(r.h, 60);
+   for (int i = 5; i < 8; ++i)
+     {
+        r = efl_gfx_entity_geometry_get(item[i]);
+
+        ck_assert_int_eq(r.y, 60 + (i - 5)*40);
+        ck_assert_int_eq(r.h, 40);
+        ck_assert_int_eq(efl_gfx_entity_visible_get(item[i]), EINA_TRUE);
+     }
+   ck_assert_int_eq(efl_gfx_entity_visible_get(item[1]), EINA_FALSE);
+   ck_assert_int_eq(efl_gfx_entity_visible_get(item[2]), EINA_FALSE);
+}
+EFL_END_TEST
+
 void efl_ui_test_list_container(TCase *tc)
 {
    tcase_add_checked_fixture(tc, fail_on_errors_setup, fail_on_errors_teardown);
@@ -314,4 +372,5 @@ void efl_ui_test_list_container(TCase *tc)
    tcase_add_test(tc, placement_test_only_items);
    tcase_add_test(tc, placement_test_group);
    tcase_add_test(tc, placement_test_group_crazy);
+   tcase_add_test(tc, placement_test_size_change);
 }
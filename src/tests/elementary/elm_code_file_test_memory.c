@@ -42,8 +42,51 @@ EFL_START_TEST(elm_code_file_memory_tokens)
 }
 EFL_END_TEST
 
+EFL_START_TEST(elm_code_file_memory_lines_index)
+{
+   Elm_Code_File *file;
+   Elm_Code_Line *line;
+   Elm_Code *code;
+   const char *text;
+   unsigned int i, length;
+
+   char *args[] = { "exe" };
+   elm_init(1, args);
+   code = elm_code_create();
+   file = code->file;
+   ck_assert_ptr_eq(NULL, elm_code_file_line_get(file, 0));
+   ck_assert_ptr_eq(NULL, elm_code_file_line_get(file, 1));
+
+   for (i = 0; i < 3000; i++)
+     elm_code_file_line_append(file, "line", 4, NULL);
+   elm_code_file_line_insert(file, 1, "first", 5, NULL);
+   elm_code_file_line_insert(file, 1500, "middle", 6, NULL);
+   ck_assert_uint_eq(3002, elm_code_file_lines_get(file));
+
+   line = elm_code_file_line_get(file, 1);
+   text = elm_code_line_text_get(line, &length);
+   ck_assert_strn_eq("first", text, length);
+   line = elm_code_file_line_get(file, 1500);
+   text = elm_code_line_text_get(line, &length);
+   ck_assert_strn_eq("middle", text, length);
+   ck_assert_ptr_eq(NULL, elm_code_file_line_get(file, 3003));
+
+   elm_code_file_line_remove(file, 1);
+   line = elm_code_file_line_get(file, 1499);
+   text = elm_code_line_text_get(line, &length);
+   ck_assert_strn_eq("middle", text, length);
+
+   for (i = 1; i <= elm_code_file_lines_get(file); i++)
+     ck_assert_uint_eq(i, elm_code_file_line_get(file, i)->number);
+
+   elm_code_free(code);
+   elm_shutdown();
+}
+EFL_END_TEST
+
 void elm_code_file_test_memory(TCase *tc)
 {
    tcase_add_test(tc, elm_code_file_memory_lines);
    tcase_add_test(tc, elm_code_file_memory_tokens);
+   tcase_add_test(tc, elm_code_file_memory_lines_index);
 }
@@ -180,6 +180,117 @@ EFL_START_TEST(elm_genlist_test_item_content)
 }
 EFL_END_TEST
 
+EFL_START_TEST(elm_genlist_test_realize_budget)
+{
+   Elm_Genlist_Item_Class *gtc;
+   Elm_Object_Item *it;
+
+   gtc = elm_genlist_item_class_new();
+   gtc->item_style = "default";
+   gtc->func.content_get = _item_content_get;
+
+   win = win_add(NULL, "genlist", ELM_WIN_BASIC);
+
+   genlist = elm_genlist_add(win);
+   ck_assert(EINA_DBL_EQ(elm_genlist_realize_budget_get(genlist), 0.0));
+
+   elm_genlist_realize_budget_set(genlist, -1.0);
+   ck_assert(EINA_DBL_EQ(elm_genlist_realize_budget_get(genlist), 0.0));
+
+   elm_genlist_realize_budget_set(genlist, 0.004);
+   ck_assert(EINA_DBL_EQ(elm_genlist_realize_budget_get(genlist), 0.004));
+
+   evas_object_smart_callback_add(genlist, "realized", _genlist_item_content_test_realize, NULL);
+   it = elm_genlist_item_append(genlist, gtc, NULL, NULL,
+                                ELM_GENLIST_ITEM_NONE, NULL, NULL);
+
+   evas_object_resize(genlist, 100, 100);
+   evas_object_resize(win, 150, 150);
+   evas_object_show(genlist);
+   evas_object_show(win);
+
+   get_me_to_those_events(win);
+
+   /* the size of a new item is not known yet, so its contents are not deferred */
+   ck_assert_ptr_ne(elm_object_item_part_content_get(it, "elm.swallow.end"), NULL);
+
+   elm_genlist_realize_budget_set(genlist, 0.0);
+   ck_assert_ptr_ne(elm_object_item_part_content_get(it, "elm.swallow.end"), NULL);
+
+   elm_genlist_item_class_free(gtc);
+}
+EFL_END_TEST
+
+static int
+_realize_budget_pending_count(void)
+{
+   Eina_List *items;
+   Elm_Object_Item *it;
+   int pending = 0;
+
+   items = elm_genlist_realized_items_get(genlist);
+   EINA_LIST_FREE(items, it)
+     if (!elm_object_item_part_content_get(it, "elm.swallow.end"))
+       pending++;
+
+   return pending;
+}
+
+EFL_START_TEST(elm_genlist_test_realize_budget_defer)
+{
+   Elm_Genlist_Item_Class *gtc;
+   Elm_Object_Item *it, *target = NULL;
+   int i, pending, prev;
+
+   gtc = elm_genlist_item_class_new();
+   gtc->item_style = "default";
+   gtc->func.content_get = _item_content_get;
+
+   win = win_add(NULL, "genlist", ELM_WIN_BASIC);
+
+   genlist = elm_genlist_add(win);
+   /* far less than creating a single content takes */
+   elm_genlist_realize_budget_set(genlist, 0.000001);
+
+   for (i = 0; i < 200; i++)
+     {
+        it = elm_genlist_item_append(genlist, gtc, NULL, NULL,
+                                     ELM_GENLIST_ITEM_NONE, NULL, NULL);
+        if (i == 150) target = it;
+     }
+
+   evas_object_resize(genlist, 100, 300);
+   evas_object_resize(win, 100, 300);
+   evas_object_show(genlist);
+   evas_object_show(win);
+
+   get_me_to_those_events(win);
+
+   /* the items scrolled into view were sized already, their contents wait */
+   elm_genlist_item_show(target, ELM_GENLIST_ITEM_SCROLLTO_TOP);
+   evas_smart_objects_calculate(evas_object_evas_get(win));
+   pending = _realize_budget_pending_count();
+   ck_assert_int_gt(pending, 1);
+
+   /* one frame realizes some of them, not all */
+   efl_event_callback_call(genlist, EFL_CANVAS_OBJECT_EVENT_ANIMATOR_TICK, NULL);
+   prev = pending;
+   pending = _realize_budget_pending_count();
+   ck_assert_int_gt(pending, 0);
+   ck_assert_int_lt(pending, prev);
+
+   /* and the queue drains over the next frames */
+   for (i = 0; (i < 200) && (pending > 0); i++)
+     {
+        efl_event_callback_call(genlist, EFL_CANVAS_OBJECT_EVENT_ANIMATOR_TICK, NULL);
+        pending = _realize_budget_pending_count();
+     }
+   ck_assert_int_eq(pending, 0);
+
+   elm_genlist_item_class_free(gtc);
+}
+EFL_END_TEST
+
 EFL_START_TEST(elm_genlist_test_legacy_type_check)
 {
    const char *type;
@@ -754,6 +865,8 @@ void elm_test_genlist(TCase *tc)
    tcase_add_test(tc, elm_genlist_test_item_destroy);
    tcase_add_test(tc, elm_genlist_test_item_iteration);
    tcase_add_test(tc, elm_genlist_test_item_content);
+   tcase_add_test(tc, elm_genlist_test_realize_budget);
+   tcase_add_test(tc, elm_genlist_test_realize_budget_defer);
    tcase_add_test(tc, elm_genlist_test_atspi_role_get);
    tcase_add_test(tc, elm_genlist_test_atspi_children_get1);
    tcase_add_test(tc, elm_genlist_test_atspi_children_get2);
@@ -26,6 +26,7 @@ static const Efl_Test_Case etc[] = {
   { "Events", evas_test_events },
   { "Efl Canvas Animation", efl_test_canvas_animation },
   { "Map", evas_test_map },
+  { "Tiler", evas_test_tiler },
   { NULL, NULL }
 };
 
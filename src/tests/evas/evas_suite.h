@@ -20,5 +20,6 @@ void evas_test_object_smart(TCase *tc);
 void evas_test_events(TCase *tc);
 void efl_test_canvas_animation(TCase *tc);
 void evas_test_map(TCase *tc);
+void evas_test_tiler(TCase *tc);
 
 #endif /* _EVAS_SUITE_H */
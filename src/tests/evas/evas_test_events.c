@@ -41,7 +41,101 @@ EFL_START_TEST(evas_test_events_frozen_mouse_up)
 }
 EFL_END_TEST
 
+EFL_START_TEST(evas_test_events_many_objects_hit)
+{
+   Evas *evas;
+   Evas_Object *bg, *rects[64];
+   Eina_List *l;
+   int i;
+
+   evas = EVAS_TEST_INIT_EVAS();
+   bg = evas_object_rectangle_add(evas);
+   evas_object_resize(bg, 500, 500);
+   evas_object_show(bg);
+   // enough objects for the hit test to go through the layer's index
+   for (i = 0; i < 64; i++)
+     {
+        rects[i] = evas_object_rectangle_add(evas);
+        evas_object_move(rects[i], (i % 8) * 50, (i / 8) * 50);
+        evas_object_resize(rects[i], 40, 40);
+        evas_object_repeat_events_set(rects[i], 1);
+        evas_object_show(rects[i]);
+     }
+
+   l = evas_tree_objects_at_xy_get(evas, NULL, 55, 55);
+   ck_assert_int_eq(eina_list_count(l), 2);
+   ck_assert_ptr_eq(eina_list_nth(l, 0), rects[9]);
+   ck_assert_ptr_eq(eina_list_nth(l, 1), bg);
+   eina_list_free(l);
+
+   l = evas_tree_objects_at_xy_get(evas, NULL, 45, 45);
+   ck_assert_int_eq(eina_list_count(l), 1);
+   ck_assert_ptr_eq(eina_list_nth(l, 0), bg);
+   eina_list_free(l);
+
+   evas_object_move(rects[0], 50, 50);
+   l = evas_tree_objects_at_xy_get(evas, NULL, 55, 55);
+   ck_assert_int_eq(eina_list_count(l), 3);
+   ck_assert_ptr_eq(eina_list_nth(l, 0), rects[9]);
+   ck_assert_ptr_eq(eina_list_nth(l, 1), rects[0]);
+   ck_assert_ptr_eq(eina_list_nth(l, 2), bg);
+   eina_list_free(l);
+
+   evas_object_repeat_events_set(rects[0], 0);
+   evas_object_raise(rects[0]);
+   l = evas_tree_objects_at_xy_get(evas, NULL, 55, 55);
+   ck_assert_int_eq(eina_list_count(l), 1);
+   ck_assert_ptr_eq(eina_list_nth(l, 0), rects[0]);
+   eina_list_free(l);
+
+   evas_object_hide(rects[0]);
+   l = evas_tree_objects_at_xy_get(evas, NULL, 55, 55);
+   ck_assert_int_eq(eina_list_count(l), 2);
+   ck_assert_ptr_eq(eina_list_nth(l, 0), rects[9]);
+   ck_assert_ptr_eq(eina_list_nth(l, 1), bg);
+   eina_list_free(l);
+}
+EFL_END_TEST
+
+EFL_START_TEST(evas_test_events_many_objects_hidden_source)
+{
+   Evas *evas;
+   Evas_Object *box, *proxy, *rects[40];
+   static int callback_called = 0;
+   int i;
+
+   evas = EVAS_TEST_INIT_EVAS();
+   box = evas_object_box_add(evas);
+   evas_object_resize(box, 400, 250);
+   // enough members for a hit test on them to go through an index, which
+   // must not be used for source events as they ignore visibility and clips
+   for (i = 0; i < 40; i++)
+     {
+        rects[i] = evas_object_rectangle_add(evas);
+        evas_object_smart_member_add(rects[i], box);
+        evas_object_move(rects[i], (i % 8) * 50, (i / 8) * 50);
+        evas_object_resize(rects[i], 40, 40);
+        evas_object_show(rects[i]);
+     }
+   evas_object_event_callback_add(rects[9], EVAS_CALLBACK_MOUSE_DOWN, _mouse_down_cb, &callback_called);
+
+   proxy = evas_object_image_filled_add(evas);
+   evas_object_image_source_set(proxy, box);
+   evas_object_image_source_events_set(proxy, EINA_TRUE);
+   evas_object_resize(proxy, 400, 250);
+   evas_object_show(proxy);
+
+   evas_event_feed_mouse_in(evas, 0, NULL);
+   evas_event_feed_mouse_move(evas, 55, 55, 0, NULL);
+   evas_event_feed_mouse_down(evas, 1, 0, 0, NULL);
+   ck_assert_int_eq(callback_called, 1);
+   evas_event_feed_mouse_up(evas, 1, 0, 0, NULL);
+}
+EFL_END_TEST
+
 void evas_test_events(TCase *tc)
 {
    tcase_add_test(tc, evas_test_events_frozen_mouse_up);
+   tcase_add_test(tc, evas_test_events_many_objects_hit);
+   tcase_add_test(tc, evas_test_events_many_objects_hidden_source);
 }
@@ -104,7 +104,7 @@ EFL_START_TEST(evas_filter_parser)
       "m = buffer() transform({ m, op = 'vflip', src = input, oy = 0 })",
       // All default commands
       "blend ({ src = input, dst = output, ox = 0, oy = 0, color = 'white', fillmode = 'none' })",
-      "blur ({ rx = 3, ry = nil, type = 'default', ox = 0, oy = 0, color = 'white', src = input, dst = output })",
+      "blur ({ rx = 3, ry = nil, type = 'default', ox = 0, oy = 0, color = 'white', src = input, dst = output, quality = 'high' })",
       "bump ({ map, azimuth = 135.0, elevation = 45.0, depth = 8.0, specular = 0.0,"
               "color = 'white', compensate = false, src = input, dst = output,"
               "black = 'black', white = 'white', fillmode = 'repeat' })",
@@ -236,6 +236,8 @@ static struct Filter_Test_Case _test_cases[] = {
    { 0, 0, 5, 5, "a = buffer ({ 'rgba' })  blend ({ dst = a })  blur ({ src = a, rx = 0, ry = 5, type = 'box' })", NULL },
    { 5, 5, 0, 0, "blur ({ rx = 5, ry = 0, type = 'gaussian' })", NULL },
    { 5, 15, 7, 0, "blur ({ rx = 5, ry = 0, ox = 10, oy = -7, type = 'default' })", NULL },
+   { 20, 20, 33, 33, "blur ({ rx = 20, ry = 33, quality = 'fast' })", NULL },
+   { 24, 24, 0, 0, "a = buffer ({ 'alpha' }) blend ({ dst = a }) blur ({ rx = 24, ry = 0, src = a, quality = 'fast' }) blend ({ a })", NULL },
 
    { 5, 5, 5, 5, "grow ({ 5 })", NULL },
 
@@ -498,10 +500,115 @@ EFL_START_TEST(evas_filter_state_test)
 }
 EFL_END_TEST
 
+EFL_START_TEST(evas_filter_cache_test)
+{
+   /* the same program on several objects shares the parsed instructions,
+    * but must still follow each object's state */
+   static const char *code = "fill { color = color(state.color) }";
+
+   const unsigned int *pixels;
+   Evas_Object *to2;
+
+   START_FILTER_TEST();
+   ecore_evas_alpha_set(ee, EINA_TRUE);
+   ecore_evas_transparent_set(ee, EINA_TRUE);
+
+   evas_object_color_set(to, 255, 0, 0, 255);
+   efl_gfx_filter_program_set(to, code, "cache");
+
+   to2 = evas_object_text_add(evas);
+   evas_object_text_font_set(to2, TEST_FONT_NAME, 20);
+   evas_object_text_text_set(to2, "Tests");
+   evas_object_text_font_source_set(to2, TEST_FONT_SOURCE);
+   evas_object_color_set(to2, 0, 255, 0, 255);
+   evas_object_show(to2);
+   efl_gfx_filter_program_set(to2, code, "cache");
+
+   ecore_evas_manual_render(ee);
+   pixels = ecore_evas_buffer_pixels_get(ee);
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-extra-args"
+   fail_if(!pixels || (*pixels != 0xFF00FF00),
+           "cache render test failed: %p (%#x)", pixels, pixels ? *pixels : 0);
+#pragma GCC diagnostic pop
+
+   evas_object_color_set(to2, 255, 0, 0, 255);
+   ecore_evas_manual_render(ee);
+   pixels = ecore_evas_buffer_pixels_get(ee);
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-extra-args"
+   fail_if(!pixels || (*pixels != 0xFFFF0000),
+           "cache render test failed: %p (%#x)", pixels, pixels ? *pixels : 0);
+#pragma GCC diagnostic pop
+
+   evas_object_text_text_set(to2, "Other tests");
+   ecore_evas_manual_render(ee);
+   pixels = ecore_evas_buffer_pixels_get(ee);
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-extra-args"
+   fail_if(!pixels || (*pixels != 0xFFFF0000),
+           "cache render test failed: %p (%#x)", pixels, pixels ? *pixels : 0);
+#pragma GCC diagnostic pop
+
+   evas_object_del(to2);
+   END_FILTER_TEST();
+}
+EFL_END_TEST
+
+EFL_START_TEST(evas_filter_cache_transition_test)
+{
+   /* every frame of a transition has its own state, more of them than the
+    * cache could hold, and the end states must still render as cached */
+   static const char *code =
+         "if state.pos < 0.5 then\n"
+         "  fill { color = color(state.color) }\n"
+         "else\n"
+         "  fill { color = color{0, 255, 0} }\n"
+         "end";
+
+   const unsigned int *pixels;
+   unsigned int expect;
+   int i;
+
+   START_FILTER_TEST();
+   ecore_evas_alpha_set(ee, EINA_TRUE);
+   ecore_evas_transparent_set(ee, EINA_TRUE);
+
+   evas_object_color_set(to, 255, 0, 0, 255);
+   efl_gfx_filter_program_set(to, code, "transition");
+
+   for (i = 0; i <= 300; i++)
+     {
+        efl_gfx_filter_state_set(to, "state1", 0.0, "state2", 1.0, i / 300.0);
+        ecore_evas_manual_render(ee);
+        pixels = ecore_evas_buffer_pixels_get(ee);
+        expect = (i < 150) ? 0xFFFF0000 : 0xFF00FF00;
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-extra-args"
+        fail_if(!pixels || (*pixels != expect),
+                "transition render test failed at %d: %p (%#x)", i, pixels, pixels ? *pixels : 0);
+#pragma GCC diagnostic pop
+     }
+
+   efl_gfx_filter_state_set(to, "state1", 0.0, "state2", 1.0, 0.0);
+   ecore_evas_manual_render(ee);
+   pixels = ecore_evas_buffer_pixels_get(ee);
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-extra-args"
+   fail_if(!pixels || (*pixels != 0xFFFF0000),
+           "transition render test failed: %p (%#x)", pixels, pixels ? *pixels : 0);
+#pragma GCC diagnostic pop
+
+   END_FILTER_TEST();
+}
+EFL_END_TEST
+
 void evas_test_filters(TCase *tc)
 {
    tcase_add_test(tc, evas_filter_parser);
    tcase_add_test(tc, evas_filter_text_padding_test);
    tcase_add_test(tc, evas_filter_text_render_test);
    tcase_add_test(tc, evas_filter_state_test);
+   tcase_add_test(tc, evas_filter_cache_test);
+   tcase_add_test(tc, evas_filter_cache_transition_test);
 }
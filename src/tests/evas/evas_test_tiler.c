@@ -0,0 +1,154 @@
+#ifdef HAVE_CONFIG_H
+# include "config.h"
+#endif
+
+#include <stdio.h>
+
+#include "../../lib/evas/include/evas_common_private.h"
+
+#include "evas_suite.h"
+
+#define TILER_W 256
+#define TILER_H 256
+
+EFL_START_TEST(evas_tiler_motion_vector_refused)
+{
+   Tilebuf *tb;
+   int num = -1;
+
+   tb = evas_common_tilebuf_new(TILER_W, TILER_H);
+   fail_if(!tb);
+
+   ck_assert_ptr_eq(evas_common_tilebuf_motion_vectors_get(tb, &num), NULL);
+   ck_assert_int_eq(num, 0);
+
+   /* what is below translucent content does not move along */
+   ck_assert_int_eq(evas_common_tilebuf_add_motion_vector(tb, 0, 0, 64, 64, 0, 8, 1), 0);
+   /* nothing moved */
+   ck_assert_int_eq(evas_common_tilebuf_add_motion_vector(tb, 0, 0, 64, 64, 0, 0, 0), 0);
+   /* nothing left to copy */
+   ck_assert_int_eq(evas_common_tilebuf_add_motion_vector(tb, 0, 0, 64, 64, 64, 0, 0), 0);
+   ck_assert_int_eq(evas_common_tilebuf_add_motion_vector(tb, 0, 0, 64, 64, 0, -80, 0), 0);
+   /* nothing left of it in the output */
+   ck_assert_int_eq(evas_common_tilebuf_add_motion_vector(tb, TILER_W, 0, 64, 64, 0, 8, 0), 0);
+   evas_common_tilebuf_motion_vectors_get(tb, &num);
+   ck_assert_int_eq(num, 0);
+
+   ck_assert_int_eq(evas_common_tilebuf_add_motion_vector(tb, 0, 0, 64, 64, 0, 8, 0), 1);
+   /* copies are done one after the other, they must not overlap */
+   ck_assert_int_eq(evas_common_tilebuf_add_motion_vector(tb, 32, 32, 64, 64, 0, 8, 0), 0);
+
+   ck_assert_int_eq(evas_common_tilebuf_add_motion_vector(tb, 64, 0, 64, 64, 0, 8, 0), 1);
+   ck_assert_int_eq(evas_common_tilebuf_add_motion_vector(tb, 128, 0, 64, 64, 0, 8, 0), 1);
+   ck_assert_int_eq(evas_common_tilebuf_add_motion_vector(tb, 192, 0, 64, 64, 0, 8, 0), 1);
+   evas_common_tilebuf_motion_vectors_get(tb, &num);
+   ck_assert_int_eq(num, TILEBUF_MOTION_MAX);
+
+   /* no room for more */
+   ck_assert_int_eq(evas_common_tilebuf_add_motion_vector(tb, 0, 128, 64, 64, 0, 8, 0), 0);
+   evas_common_tilebuf_motion_vectors_get(tb, &num);
+   ck_assert_int_eq(num, TILEBUF_MOTION_MAX);
+
+   /* vectors only last one frame */
+   evas_common_tilebuf_clear(tb);
+   ck_assert_ptr_eq(evas_common_tilebuf_motion_vectors_get(tb, &num), NULL);
+   ck_assert_int_eq(num, 0);
+
+   evas_common_tilebuf_free(tb);
+}
+EFL_END_TEST
+
+EFL_START_TEST(evas_tiler_motion_vector_clip)
+{
+   const Tilebuf_Motion_Vector *mv;
+   Tilebuf *tb;
+   int num = 0;
+
+   tb = evas_common_tilebuf_new(TILER_W, TILER_H);
+   fail_if(!tb);
+
+   ck_assert_int_eq(evas_common_tilebuf_add_motion_vector(tb, -16, -32, 100, 100, 4, -8, 0), 1);
+   ck_assert_int_eq(evas_common_tilebuf_add_motion_vector(tb, 200, 220, 100, 100, -4, 8, 0), 1);
+
+   mv = evas_common_tilebuf_motion_vectors_get(tb, &num);
+   fail_if(!mv);
+   ck_assert_int_eq(num, 2);
+
+   ck_assert_int_eq(mv[0].x, 0);
+   ck_assert_int_eq(mv[0].y, 0);
+   ck_assert_int_eq(mv[0].w, 84);
+   ck_assert_int_eq(mv[0].h, 68);
+   ck_assert_int_eq(mv[0].dx, 4);
+   ck_assert_int_eq(mv[0].dy, -8);
+
+   ck_assert_int_eq(mv[1].x, 200);
+   ck_assert_int_eq(mv[1].y, 220);
+   ck_assert_int_eq(mv[1].w, TILER_W - 200);
+   ck_assert_int_eq(mv[1].h, TILER_H - 220);
+   ck_assert_int_eq(mv[1].dx, -4);
+   ck_assert_int_eq(mv[1].dy, 8);
+
+   evas_common_tilebuf_free(tb);
+}
+EFL_END_TEST
+
+static void
+_motion_vector_apply_check(int dx, int dy, int ex, int ey, int ew, int eh)
+{
+   const Tilebuf_Motion_Vector *mv;
+   Tilebuf_Rect *rects, *r;
+   Tilebuf *tb;
+   int x, y, w, h, num = 0, area = 0;
+
+   tb = evas_common_tilebuf_new(TILER_W, TILER_H);
+   fail_if(!tb);
+   evas_common_tilebuf_set_tile_size(tb, 16, 16);
+
+   ck_assert_int_eq(evas_common_tilebuf_add_motion_vector(tb, 0, 0, TILER_W, TILER_H, dx, dy, 0), 1);
+   mv = evas_common_tilebuf_motion_vectors_get(tb, &num);
+   ck_assert_int_eq(num, 1);
+
+   /* what the engine does once the copy went through: redraw the whole
+    * area but for what was copied */
+   evas_common_tilebuf_add_redraw(tb, 0, 0, TILER_W, TILER_H);
+   evas_common_tilebuf_motion_vector_copy_get(mv, &x, &y, &w, &h);
+   ck_assert_int_eq(x - dx, (dx < 0) ? -dx : 0);
+   ck_assert_int_eq(y - dy, (dy < 0) ? -dy : 0);
+   ck_assert_int_eq(w, TILER_W - abs(dx));
+   ck_assert_int_eq(h, TILER_H - abs(dy));
+   evas_common_tilebuf_del_redraw(tb, x, y, w, h);
+
+   /* only the uncovered strip is left */
+   rects = evas_common_tilebuf_get_render_rects(tb);
+   fail_if(!rects);
+   EINA_INLIST_FOREACH(EINA_INLIST_GET(rects), r)
+     {
+        fail_if((r->x < ex) || (r->y < ey) ||
+                ((r->x + r->w) > (ex + ew)) || ((r->y + r->h) > (ey + eh)));
+        area += r->w * r->h;
+     }
+   ck_assert_int_eq(area, ew * eh);
+
+   evas_common_tilebuf_free_render_rects(rects);
+   evas_common_tilebuf_free(tb);
+}
+
+EFL_START_TEST(evas_tiler_motion_vector_apply)
+{
+   /* scrolled up, the bottom strip is new */
+   _motion_vector_apply_check(0, -32, 0, TILER_H - 32, TILER_W, 32);
+   /* scrolled down, the top strip is new */
+   _motion_vector_apply_check(0, 48, 0, 0, TILER_W, 48);
+   /* scrolled right, the left strip is new */
+   _motion_vector_apply_check(16, 0, 0, 0, 16, TILER_H);
+   /* scrolled left, the right strip is new */
+   _motion_vector_apply_check(-64, 0, TILER_W - 64, 0, 64, TILER_H);
+}
+EFL_END_TEST
+
+void evas_test_tiler(TCase *tc)
+{
+   tcase_add_test(tc, evas_tiler_motion_vector_refused);
+   tcase_add_test(tc, evas_tiler_motion_vector_clip);
+   tcase_add_test(tc, evas_tiler_motion_vector_apply);
+}